@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+
+// Desired-value holder for one output channel. Callers request values as often
+// as they like; the main loop calls service() and writes the hardware only when
+// it returns true. That gives at most one write per PWM period, and no write at
+// all when the value did not change.
+//
+// The LEDC peripheral latches a new duty at the start of the next period, so
+// only the last write in a period matters. service() therefore holds a changed
+// value until the final commitWindowUs of the period (phase measured from
+// anchor(), the time the timer was configured, and carried forward from each
+// write). If a slow loop pass misses that window the value is written as soon
+// as service() runs again.
+//
+// periodUs == 0 means the output has no period (plain GPIO). Changes are then
+// written on the next service() call and only deduplicated.
+class Actuator {
+public:
+  Actuator(uint32_t periodUs, uint32_t commitWindowUs) : periodUs_(periodUs), windowUs_(commitWindowUs) {}
+
+  void anchor(uint32_t nowUs) { anchorUs_ = nowUs; }
+
+  void request(uint32_t value, uint32_t nowUs) {
+    // Either this value replaces one that was never written, or it is
+    // already on the pin. In both cases one write is saved.
+    if (pending_ || (committedOnce_ && value == committed_)) ++writesSkipped_;
+    if (!pending_) pendingSinceUs_ = nowUs;
+    desired_ = value;
+    pending_ = !committedOnce_ || desired_ != committed_;
+  }
+
+  bool service(uint32_t nowUs) {
+    if (!pending_) return false;
+    if (committedOnce_ && periodUs_ != 0 && usUntilDue(nowUs) != 0) return false;
+    if (periodUs_ != 0) commitPhaseUs_ = phaseAt(nowUs);
+    lastCommitUs_ = nowUs;
+    committed_ = desired_;
+    committedOnce_ = true;
+    pending_ = false;
+    ++writesIssued_;
+    return true;
+  }
+
+  // Microseconds until service() would write the pending value; UINT32_MAX if
+  // nothing is pending. Lets the main loop sleep exactly until the next write.
+  //
+  // Time is measured as elapsed microseconds from the start of the period the
+  // last write went out in, so the comparison survives micros() wrapping. The
+  // pending value is due in the window of its own period, but never before
+  // the period after the last write; if that window was missed it is due now.
+  uint32_t usUntilDue(uint32_t nowUs) const {
+    if (!pending_) return UINT32_MAX;
+    if (!committedOnce_ || periodUs_ == 0) return 0;
+    const uint64_t sinceCommitPeriod = commitPhaseUs_ + static_cast<uint64_t>(nowUs - lastCommitUs_);
+    const uint64_t pendingSincePeriod = commitPhaseUs_ + static_cast<uint64_t>(pendingSinceUs_ - lastCommitUs_);
+    const uint64_t slot = sinceCommitPeriod / periodUs_;
+    const uint32_t phase = static_cast<uint32_t>(sinceCommitPeriod % periodUs_);
+    const uint32_t windowStart = periodUs_ - windowUs_;
+    uint64_t eligible = pendingSincePeriod / periodUs_;
+    if (eligible == 0) eligible = 1;
+    if (slot > eligible) return 0;  // window missed, write now
+    if (slot == eligible) return phase >= windowStart ? 0 : windowStart - phase;
+    const uint64_t wait = (eligible - slot) * periodUs_ - phase + windowStart;
+    return wait < UINT32_MAX ? static_cast<uint32_t>(wait) : UINT32_MAX - 1;
+  }
+
+  uint32_t value() const { return desired_; }
+  bool pending() const { return pending_; }
+  uint32_t writesIssued() const { return writesIssued_; }
+  uint32_t writesSkipped() const { return writesSkipped_; }
+
+private:
+  // Phase within the PWM period. After the first write it follows on from the
+  // last write rather than from anchor(), so the period grid stays put when
+  // micros() wraps.
+  uint32_t phaseAt(uint32_t nowUs) const {
+    if (!committedOnce_) return (nowUs - anchorUs_) % periodUs_;
+    return static_cast<uint32_t>((commitPhaseUs_ + static_cast<uint64_t>(nowUs - lastCommitUs_)) % periodUs_);
+  }
+
+  uint32_t periodUs_;
+  uint32_t windowUs_;
+  uint32_t anchorUs_ = 0;
+  uint32_t desired_ = 0;
+  uint32_t committed_ = 0;
+  uint32_t pendingSinceUs_ = 0;
+  uint32_t lastCommitUs_ = 0;
+  uint32_t commitPhaseUs_ = 0;  // phase of lastCommitUs_ within its period
+  bool committedOnce_ = false;
+  bool pending_ = false;
+  uint32_t writesIssued_ = 0;
+  uint32_t writesSkipped_ = 0;
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+// Connection budgets. Page loads and WebSocket sessions share the server's
+// TLS connection pool, but each kind has its own limit. One WebSocket slot is
+// held back for the driver (the client that last sent a control command)
+// while they are connected or briefly reconnecting.
+
+// True if a page request may be served on one of `openConnections`, of which
+// `wsSessions` are WebSocket sessions. The requesting connection is counted.
+inline bool admitHttpRequest(uint8_t openConnections, uint8_t wsSessions, uint8_t httpSlots) {
+  return openConnections - wsSessions <= httpSlots;
+}
+
+// True if a WebSocket session may stay, given the `otherSessions` already
+// admitted. `driverSlotHeld` is true while the driver is away but within the
+// reconnect grace period.
+inline bool admitWsSession(uint8_t otherSessions, uint8_t wsSlots, bool isDriver, bool driverSlotHeld) {
+  const uint8_t limit = (isDriver || !driverSlotHeld) ? wsSlots : wsSlots - 1;
+  return otherSessions < limit;
+}
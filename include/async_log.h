@@ -0,0 +1,267 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Asynchronous, level-filtered logging for the control path.
+//
+// LOG_ERROR/LOG_WARN/LOG_INFO/LOG_DEBUG copy the format pointer and up to
+// kLogMaxArgs scalar arguments into a binary record in a lock-free ring and
+// return. No formatting, no Serial I/O and no lock on the caller's side. A
+// low-priority task pops records, formats them and writes them out. When the
+// ring is full the record is dropped and counted; the caller never waits.
+//
+// Levels above LOG_LEVEL compile to nothing, arguments included. Build with
+// -DLOG_LEVEL=LOG_LEVEL_DEBUG to get the per-frame traces.
+//
+// The format and any %s argument must be string literals or otherwise live
+// forever: only the pointers are stored.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+constexpr size_t kLogMaxArgs = 6;
+
+union LogValue {
+  int32_t i;
+  uint32_t u;
+  float f;
+  const char *s;
+};
+
+enum class LogArgType : uint8_t { Int, UInt, Float, Str };
+
+struct LogArg {
+  LogArgType type;
+  LogValue value;
+};
+
+inline LogArg logArg(int v) { LogArg a; a.type = LogArgType::Int; a.value.i = v; return a; }
+inline LogArg logArg(long v) { LogArg a; a.type = LogArgType::Int; a.value.i = static_cast<int32_t>(v); return a; }
+inline LogArg logArg(unsigned v) { LogArg a; a.type = LogArgType::UInt; a.value.u = v; return a; }
+inline LogArg logArg(unsigned long v) { LogArg a; a.type = LogArgType::UInt; a.value.u = static_cast<uint32_t>(v); return a; }
+inline LogArg logArg(double v) { LogArg a; a.type = LogArgType::Float; a.value.f = static_cast<float>(v); return a; }
+inline LogArg logArg(const char *v) { LogArg a; a.type = LogArgType::Str; a.value.s = v; return a; }
+
+struct LogRecord {
+  uint32_t timeUs;
+  const char *format;
+  uint8_t level;
+  uint8_t argc;
+  LogArgType types[kLogMaxArgs];
+  LogValue values[kLogMaxArgs];
+};
+
+// Formats `record` as "<level> <seconds>.<ms> <message>\n" into `out`,
+// truncating to `size`. Returns the length written (excluding the NUL).
+// Each conversion is formatted on its own, using the conversion character to
+// pick the type, so a record can never make snprintf read a missing argument.
+inline size_t formatLogRecord(const LogRecord &record, char *out, size_t size) {
+  static const char kLevels[] = "?EWID";
+  if (size == 0) return 0;
+  size_t len = 0;
+  auto room = [&]() { return len < size ? size - len : 0; };
+  auto advance = [&](int n) {
+    if (n > 0) len += static_cast<size_t>(n);
+    if (len >= size) len = size - 1;
+  };
+
+  advance(snprintf(out, size, "%c %lu.%03lu ", kLevels[record.level < 5 ? record.level : 0],
+                   static_cast<unsigned long>(record.timeUs / 1000000u),
+                   static_cast<unsigned long>(record.timeUs / 1000u % 1000u)));
+
+  uint8_t arg = 0;
+  for (const char *p = record.format; *p != '\0' && len + 1 < size; ++p) {
+    if (*p != '%') {
+      out[len++] = *p;
+      continue;
+    }
+    if (p[1] == '%') {
+      out[len++] = '%';
+      ++p;
+      continue;
+    }
+    // Copy flags/width/precision, drop length modifiers; the stored value
+    // is passed as a plain int/unsigned/double/pointer.
+    char spec[16] = "%";
+    size_t specLen = 1;
+    const char *q = p + 1;
+    while (*q != '\0' && strchr("-+ #0123456789.", *q) != nullptr && specLen < sizeof(spec) - 3) spec[specLen++] = *q++;
+    while (*q == 'l' || *q == 'h' || *q == 'z') ++q;
+    const char conv = *q;
+    if (conv == '\0') break;
+    spec[specLen++] = conv;
+    spec[specLen] = '\0';
+    p = q;
+
+    if (arg >= record.argc) {
+      advance(snprintf(out + len, room(), "<?>"));
+      continue;
+    }
+    const LogArgType type = record.types[arg];
+    const LogValue v = record.values[arg++];
+    switch (conv) {
+      case 'd':
+      case 'i':
+      case 'c':
+        advance(snprintf(out + len, room(), spec,
+                         type == LogArgType::Float ? static_cast<int>(v.f) : static_cast<int>(v.i)));
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+        advance(snprintf(out + len, room(), spec,
+                         type == LogArgType::Float ? static_cast<unsigned>(v.f) : static_cast<unsigned>(v.u)));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+        advance(snprintf(out + len, room(), spec,
+                         type == LogArgType::Float ? static_cast<double>(v.f)
+                         : type == LogArgType::UInt ? static_cast<double>(v.u)
+                                                    : static_cast<double>(v.i)));
+        break;
+      case 's':
+        advance(snprintf(out + len, room(), spec, type == LogArgType::Str && v.s != nullptr ? v.s : "<?>"));
+        break;
+      default:
+        advance(snprintf(out + len, room(), "<?>"));
+        break;
+    }
+  }
+  if (len + 1 < size) out[len++] = '\n';
+  out[len] = '\0';
+  return len;
+}
+
+// Bounded multi-producer, single-consumer ring (Vyukov's sequence-numbered
+// cells). Producers on any task claim a cell with one compare-and-swap and
+// publish it with a release store; the consumer never blocks them.
+template <size_t Slots>
+class LogRing {
+  static_assert(Slots >= 2 && (Slots & (Slots - 1)) == 0, "Slots must be a power of two");
+
+public:
+  LogRing() {
+    for (size_t i = 0; i < Slots; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  // Returns false (and counts a drop) if the ring is full.
+  bool push(const LogRecord &record) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell &cell = cells_[pos & (Slots - 1)];
+      const size_t seq = cell.sequence.load(std::memory_order_acquire);
+      const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.record = record;
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Consumer side; one task only.
+  bool pop(LogRecord &record) {
+    Cell &cell = cells_[tail_ & (Slots - 1)];
+    if (cell.sequence.load(std::memory_order_acquire) != tail_ + 1) return false;
+    record = cell.record;
+    cell.sequence.store(tail_ + Slots, std::memory_order_release);
+    ++tail_;
+    return true;
+  }
+
+  uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    LogRecord record;
+  };
+
+  Cell cells_[Slots];
+  std::atomic<size_t> head_{0};
+  size_t tail_ = 0;
+  std::atomic<uint32_t> dropped_{0};
+};
+
+#ifndef LOG_RING_SLOTS
+#define LOG_RING_SLOTS 64
+#endif
+
+class AsyncLog {
+public:
+  using ClockFn = uint32_t (*)();
+
+  void setClock(ClockFn clock) { clock_ = clock; }
+
+  template <typename... Args>
+  bool write(uint8_t level, const char *format, Args... args) {
+    static_assert(sizeof...(Args) <= kLogMaxArgs, "too many log arguments");
+    LogRecord record;
+    record.timeUs = clock_ != nullptr ? clock_() : 0;
+    record.format = format;
+    record.level = level;
+    record.argc = static_cast<uint8_t>(sizeof...(Args));
+    const LogArg captured[] = {logArg(args)..., LogArg()};
+    for (uint8_t i = 0; i < record.argc; ++i) {
+      record.types[i] = captured[i].type;
+      record.values[i] = captured[i].value;
+    }
+    return ring_.push(record);
+  }
+
+  bool pop(LogRecord &record) { return ring_.pop(record); }
+  uint32_t dropped() const { return ring_.dropped(); }
+
+private:
+  LogRing<LOG_RING_SLOTS> ring_;
+  ClockFn clock_ = nullptr;
+};
+
+inline AsyncLog &asyncLog() {
+  static AsyncLog log;
+  return log;
+}
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) asyncLog().write(LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define LOG_ERROR(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) asyncLog().write(LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define LOG_WARN(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) asyncLog().write(LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define LOG_INFO(...) do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) asyncLog().write(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do {} while (0)
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Startup timeline. Each phase is marked once, by the one task that runs it,
+// with the time since app start; the loop task reports the timeline once the
+// car is ready and again when the first control frame is applied.
+
+enum class BootPhase : uint8_t {
+  ActuatorsSafe,  // servo centred, motor at 0, headlight off
+  LogReady,       // async log task running
+  NetStackUp,     // Wi-Fi driver and lwIP initialised
+  ServerUp,       // TLS key/cert parsed, HTTPS listener open
+  ChannelPicked,  // Wi-Fi scan done (or channel pinned)
+  ApUp,           // soft AP beaconing
+  Ready,          // AP and server both up: a phone can connect and steer
+  FirstControl,   // first control frame applied
+  Count
+};
+
+inline const char *bootPhaseName(BootPhase phase) {
+  static const char *const kNames[] = {"actuators safe", "log ready", "net stack up", "server up",
+                                       "channel picked", "AP up",     "ready",        "first control"};
+  static_assert(sizeof(kNames) / sizeof(kNames[0]) == static_cast<size_t>(BootPhase::Count),
+                "bootPhaseName must cover every BootPhase");
+  return phase < BootPhase::Count ? kNames[static_cast<size_t>(phase)] : "?";
+}
+
+class BootPhases {
+public:
+  // Records `phase` at `nowUs` unless it was already marked. Returns true on
+  // the first mark. A phase marked at time 0 is stored as 1 us.
+  bool mark(BootPhase phase, uint32_t nowUs) {
+    uint32_t expected = 0;
+    return at_[static_cast<size_t>(phase)].compare_exchange_strong(expected, nowUs == 0 ? 1 : nowUs,
+                                                                   std::memory_order_release,
+                                                                   std::memory_order_relaxed);
+  }
+
+  bool reached(BootPhase phase) const { return atUs(phase) != 0; }
+
+  // Time since app start the phase completed, 0 if not yet.
+  uint32_t atUs(BootPhase phase) const { return at_[static_cast<size_t>(phase)].load(std::memory_order_acquire); }
+
+  // How long the phase itself took: from the end of the phase it waited on to
+  // its own end. The server and the AP are brought up in parallel, both
+  // starting when the network stack is up; Ready waits for both.
+  uint32_t durationUs(BootPhase phase) const {
+    if (!reached(phase)) return 0;
+    uint32_t startUs = 0;
+    switch (phase) {
+      case BootPhase::ActuatorsSafe:
+        break;
+      case BootPhase::ServerUp:
+      case BootPhase::ChannelPicked:
+        startUs = atUs(BootPhase::NetStackUp);
+        break;
+      case BootPhase::Ready: {
+        const uint32_t server = atUs(BootPhase::ServerUp);
+        const uint32_t ap = atUs(BootPhase::ApUp);
+        startUs = server > ap ? server : ap;
+        break;
+      }
+      default:
+        startUs = atUs(static_cast<BootPhase>(static_cast<uint8_t>(phase) - 1));
+        break;
+    }
+    return atUs(phase) > startUs ? atUs(phase) - startUs : 0;
+  }
+
+private:
+  std::atomic<uint32_t> at_[static_cast<size_t>(BootPhase::Count)] = {};
+};
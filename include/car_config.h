@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+
+#include "vehicle_profiles.h"
+
+// Vehicle configuration shared by the firmware and the native test/bench build.
+// Keep this header free of Arduino includes.
+//
+// Per-chassis values live in the profile structs in vehicle_profiles.h.
+// This file holds what every chassis shares, plus the checks run on a profile.
+
+#ifndef VEHICLE_PROFILE
+#define VEHICLE_PROFILE BuggyProfile
+#endif
+
+// The chassis this binary is built for.
+using Vehicle = VEHICLE_PROFILE;
+
+// ====== Servo PWM config ======
+constexpr uint8_t servoChannel = 0;
+constexpr uint32_t servoFreq = 50;          // 50 Hz for standard servos
+constexpr uint8_t servoResolution = 15;     // 15-bit resolution
+constexpr uint32_t servoPeriodUs = 20000;   // 20 ms period at 50 Hz
+constexpr uint32_t servoCommitWindowUs = 2000; // write steering in the last 2 ms of a period
+
+// ====== Motor PWM config ======
+// LEDC channels share a timer in pairs (timer = channel / 2), and ledcSetup()
+// reconfigures the whole timer. The motor needs a timer of its own, or the
+// servo's 50 Hz / 15-bit setup would take over the motor's frequency too.
+constexpr uint8_t motorChannel = 2;
+static_assert(servoChannel / 2 != motorChannel / 2, "servo and motor need separate LEDC timers");
+constexpr uint32_t motorPeriodUs = 1000000 / Vehicle::motorFreq;  // holds because the timer is the motor's alone
+constexpr uint32_t motorUpdateIntervalMs = 20;
+constexpr uint32_t motorCorrectionIntervalMs = 500; // UI resync while it extrapolates a ramp
+
+// Compile-time sanity checks for a profile. Instantiated by every function in
+// control.h, so a bad profile fails the build instead of misbehaving on the car.
+constexpr bool isOutputGpio(int pin) { return pin >= 0 && pin < 34; }  // GPIO 34..39 are input only
+
+template <typename P>
+struct VehicleChecks {
+  static_assert(P::servoMin >= 0 && P::servoMin < P::servoMax && P::servoMax <= 180, "servo range must be 0..180 and non-empty");
+  static_assert(P::servoPulseMinUs > 0 && P::servoPulseMinUs < P::servoPulseMaxUs, "servo pulse range must be non-empty");
+  static_assert(P::servoPulseMaxUs < static_cast<int>(servoPeriodUs - servoCommitWindowUs),
+                "servo pulse must end before the steering commit window");
+  static_assert(P::tiltMin < P::tiltMax, "tilt range must be non-empty");
+  static_assert(P::motorResolution >= 1 && P::motorResolution <= 16, "LEDC resolution is 1..16 bits");
+  static_assert(static_cast<uint64_t>(P::motorFreq) << P::motorResolution <= 80000000ull,
+                "motorFreq * 2^motorResolution must not exceed the 80 MHz LEDC clock");
+  static_assert(P::motorDutyMax > 0.0f && P::motorDutyMax <= 1.0f, "motorDutyMax must be in (0, 1]");
+  static_assert(P::motorAccelPerMs > 0.0f && P::motorDecelPerMs > 0.0f, "motor ramp rates must be positive");
+  static_assert(isOutputGpio(P::servoPin) && isOutputGpio(P::motorPwmPin) && isOutputGpio(P::headlightPin),
+                "servo, motor and headlight need output-capable GPIOs");
+  static_assert(P::servoPin != P::motorPwmPin && P::servoPin != P::headlightPin && P::motorPwmPin != P::headlightPin,
+                "output pins must be distinct");
+  static_assert(P::encoderPin == -1 || (P::encoderPin >= 0 && P::encoderPin <= 39 && P::encoderPin != P::servoPin &&
+                                        P::encoderPin != P::motorPwmPin && P::encoderPin != P::headlightPin),
+                "encoderPin must be -1 or a free GPIO");
+  static_assert(P::encoderGlitchFilter <= 1023, "PCNT glitch filter is 10 bits");
+  static_assert(P::encoderPin == -1 || (P::encoderPulsesPerMeter > 0.0f && P::speedMaxMps > 0.0f &&
+                                        P::launchAccelMps2 > 0.0f && P::slipAccelMps2 > P::launchAccelMps2 &&
+                                        P::slipCut > 0.0f && P::slipCut < 1.0f),
+                "speed control needs positive scales and slipAccelMps2 above launchAccelMps2");
+
+  static constexpr bool ok = true;
+};
+
+static_assert(VehicleChecks<Vehicle>::ok, "");
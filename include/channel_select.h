@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Soft AP channel selection from a Wi-Fi scan. Hardware-free so recorded scans
+// can be replayed in the native build.
+
+struct ScanResult {
+  uint8_t channel;
+  int8_t rssi;  // dBm
+};
+
+constexpr uint8_t kFirstApChannel = 1;
+constexpr uint8_t kLastApChannel = 11;  // usable in every regulatory domain
+
+// 2.4 GHz channels are 5 MHz apart with ~22 MHz wide signals, so an AP
+// disturbs up to four channels either side, less the further away it is.
+inline float channelOverlap(uint8_t a, uint8_t b) {
+  const int distance = a > b ? a - b : b - a;
+  return distance >= 5 ? 0.0f : static_cast<float>(5 - distance) / 5.0f;
+}
+
+// Every AP costs 1 for being there (beacons, contention), plus up to ~2 more
+// for how loud it is: 0 at -100 dBm, 1 at -50 dBm, 2 at 0 dBm.
+inline float apWeight(int8_t rssi) {
+  float loudness = (static_cast<float>(rssi) + 100.0f) / 50.0f;
+  if (loudness < 0.0f) loudness = 0.0f;
+  return 1.0f + loudness;
+}
+
+// Congestion score of `channel`; lower is quieter.
+inline float channelCongestion(uint8_t channel, const ScanResult *aps, size_t count) {
+  float score = 0.0f;
+  for (size_t i = 0; i < count; ++i) {
+    score += channelOverlap(channel, aps[i].channel) * apWeight(aps[i].rssi);
+  }
+  return score;
+}
+
+// Picks the quietest channel. Ties go to the non-overlapping channels
+// 1/6/11, then to the lowest channel number.
+inline uint8_t pickQuietestChannel(const ScanResult *aps, size_t count, uint8_t first = kFirstApChannel,
+                                   uint8_t last = kLastApChannel) {
+  uint8_t best = first;
+  float bestScore = 0.0f;
+  bool bestPreferred = false;
+  for (uint8_t ch = first; ch <= last; ++ch) {
+    const float score = channelCongestion(ch, aps, count);
+    const bool preferred = ch == 1 || ch == 6 || ch == 11;
+    const bool better = ch == first || score < bestScore - 0.001f ||
+                        (score < bestScore + 0.001f && preferred && !bestPreferred);
+    if (better) {
+      best = ch;
+      bestScore = score;
+      bestPreferred = preferred;
+    }
+  }
+  return best;
+}
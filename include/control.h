@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+#include "car_config.h"
+
+// Pure steering/throttle math. No hardware access so it can run in the native build.
+//
+// Every function is templated on a vehicle profile and defaults to the one the
+// build selected, so range limits, inversion and table sizes are compile-time
+// constants and a profile that fails VehicleChecks does not compile.
+
+template <typename P = Vehicle>
+inline int mapTiltToAngle(float tilt) {
+  static_assert(VehicleChecks<P>::ok, "");
+  // Inversion swaps the tilt end that maps to servoMin; no runtime branch.
+  constexpr float fromTilt = P::invertSteering ? P::tiltMax : P::tiltMin;
+  constexpr float toTilt = P::invertSteering ? P::tiltMin : P::tiltMax;
+  if (tilt < P::tiltMin) tilt = P::tiltMin;
+  if (tilt > P::tiltMax) tilt = P::tiltMax;
+  const float norm = (tilt - fromTilt) / (toTilt - fromTilt);
+  return P::servoMin + static_cast<int>(norm * (P::servoMax - P::servoMin));
+}
+
+template <typename P>
+constexpr std::array<uint32_t, P::servoMax - P::servoMin + 1> makeServoDutyTable() {
+  std::array<uint32_t, P::servoMax - P::servoMin + 1> table{};
+  constexpr uint32_t maxDuty = (1u << servoResolution) - 1u;
+  for (int angle = P::servoMin; angle <= P::servoMax; ++angle) {
+    const int pulseUs = P::servoPulseMinUs + (angle - P::servoMin) * (P::servoPulseMaxUs - P::servoPulseMinUs) /
+                                                 (P::servoMax - P::servoMin);
+    table[angle - P::servoMin] = static_cast<uint32_t>((static_cast<uint64_t>(pulseUs) * maxDuty) / servoPeriodUs);
+  }
+  return table;
+}
+
+// LEDC duty counts for every servo angle of a profile, built by the compiler.
+template <typename P>
+struct ServoDutyTable {
+  static constexpr std::array<uint32_t, P::servoMax - P::servoMin + 1> duty = makeServoDutyTable<P>();
+};
+
+// LEDC duty counts for a servo angle (clamped to servoMin..servoMax).
+template <typename P = Vehicle>
+inline uint32_t servoDutyForAngle(int angle) {
+  static_assert(VehicleChecks<P>::ok, "");
+  if (angle < P::servoMin) angle = P::servoMin;
+  if (angle > P::servoMax) angle = P::servoMax;
+  return ServoDutyTable<P>::duty[angle - P::servoMin];
+}
+
+// LEDC duty counts for a motor duty fraction (clamped to 0..motorDutyMax).
+template <typename P = Vehicle>
+inline uint32_t motorPwmForDuty(float duty) {
+  static_assert(VehicleChecks<P>::ok, "");
+  constexpr uint32_t maxDuty = (1u << P::motorResolution) - 1u;
+  if (duty < 0.0f) duty = 0.0f;
+  if (duty > P::motorDutyMax) duty = P::motorDutyMax;
+  return static_cast<uint32_t>(duty * maxDuty + 0.5f);
+}
+
+// One ramp step of the throttle: accelerate while gas is held, coast down otherwise.
+template <typename P = Vehicle>
+inline float stepMotorDuty(float duty, bool gasPressed, unsigned long elapsedMs) {
+  static_assert(VehicleChecks<P>::ok, "");
+  const float ratePerMs = gasPressed ? P::motorAccelPerMs : -P::motorDecelPerMs;
+  float newDuty = duty + ratePerMs * static_cast<float>(elapsedMs);
+  if (newDuty < 0.0f) newDuty = 0.0f;
+  if (newDuty > P::motorDutyMax) newDuty = P::motorDutyMax;
+  return newDuty;
+}
+
+// With an encoder the ramped duty is a speed request for SpeedController. The
+// ramp stops at motorDutyMax, so that is full throttle: 1.0, speedMaxMps.
+template <typename P = Vehicle>
+inline float speedRequest(float throttle) {
+  static_assert(VehicleChecks<P>::ok, "");
+  return throttle / P::motorDutyMax;
+}
+
+// Whether a tick that moved the duty should also resync clients, which
+// extrapolate the ramp from the ramp frame: once it settles at either end,
+// and otherwise every motorCorrectionIntervalMs.
+template <typename P = Vehicle>
+inline bool rampResyncDue(float duty, uint32_t msSinceCorrection) {
+  static_assert(VehicleChecks<P>::ok, "");
+  const bool settled = duty <= 0.0f || duty >= P::motorDutyMax;
+  return settled || msSinceCorrection >= motorCorrectionIntervalMs;
+}
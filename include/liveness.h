@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+// Dead-peer detection for one WebSocket session.
+//
+// Any frame from the client proves it is alive. After intervalMs of silence
+// the server sends a ping, and another every intervalMs while the silence
+// lasts. A client that leaves missLimit pings unanswered is evicted, so a
+// vanished phone is dropped (missLimit + 1) * intervalMs after it was last
+// heard. Once a ping has gone a whole interval unanswered the peer is
+// suspect: broadcasts to it are held back so its TCP send buffer cannot fill
+// up and block the loop while we wait for the verdict.
+class PeerLiveness {
+public:
+  enum class Action : uint8_t { None, Ping, Evict };
+
+  PeerLiveness(uint32_t intervalMs, uint8_t missLimit) : intervalMs_(intervalMs), missLimit_(missLimit) {}
+
+  void heard(uint32_t nowMs) {
+    lastHeardMs_ = nowMs;
+    unanswered_ = 0;
+  }
+
+  Action poll(uint32_t nowMs) {
+    if (nowMs - lastHeardMs_ < dueAfterMs()) return Action::None;
+    if (unanswered_ >= missLimit_) return Action::Evict;
+    ++unanswered_;
+    return Action::Ping;
+  }
+
+  // Milliseconds until poll() has something to do.
+  uint32_t msUntilDue(uint32_t nowMs) const {
+    const uint32_t silentMs = nowMs - lastHeardMs_;
+    return silentMs >= dueAfterMs() ? 0 : dueAfterMs() - silentMs;
+  }
+
+  bool suspect(uint32_t nowMs) const { return nowMs - lastHeardMs_ >= 2 * intervalMs_; }
+
+  uint32_t silentMs(uint32_t nowMs) const { return nowMs - lastHeardMs_; }
+
+private:
+  uint32_t dueAfterMs() const { return (static_cast<uint32_t>(unanswered_) + 1) * intervalMs_; }
+
+  uint32_t intervalMs_;
+  uint8_t missLimit_;
+  uint8_t unanswered_ = 0;
+  uint32_t lastHeardMs_ = 0;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+
+// Accounting for the event-driven main loop.
+//
+// blockedUs / (blockedUs + awakeUs) is the share of time the loop spent
+// waiting for sockets or timers. That is the figure to watch for idle current.
+// Wake latency is the time from the socket wake-up to the resulting command
+// reaching the control state (servo/motor request).
+class LoopStats {
+public:
+  void recordBlocked(uint32_t us) { blockedUs_ += us; }
+  void recordAwake(uint32_t us) { awakeUs_ += us; }
+
+  void recordWake(bool byNetwork) {
+    ++wakes_;
+    if (byNetwork) ++networkWakes_;
+  }
+
+  void recordWakeLatency(uint32_t us) {
+    ++latencySamples_;
+    latencySumUs_ += us;
+    if (us > latencyMaxUs_) latencyMaxUs_ = us;
+  }
+
+  // Percent of wall time spent blocked, 0..100.
+  float idlePercent() const {
+    const uint64_t total = blockedUs_ + awakeUs_;
+    return total == 0 ? 0.0f : 100.0f * static_cast<float>(blockedUs_) / static_cast<float>(total);
+  }
+
+  uint32_t wakes() const { return wakes_; }
+  uint32_t networkWakes() const { return networkWakes_; }
+  uint32_t latencyAvgUs() const {
+    return latencySamples_ == 0 ? 0 : static_cast<uint32_t>(latencySumUs_ / latencySamples_);
+  }
+  uint32_t latencyMaxUs() const { return latencyMaxUs_; }
+
+  void reset() { *this = LoopStats(); }
+
+private:
+  uint64_t blockedUs_ = 0;
+  uint64_t awakeUs_ = 0;
+  uint32_t wakes_ = 0;
+  uint32_t networkWakes_ = 0;
+  uint32_t latencySamples_ = 0;
+  uint64_t latencySumUs_ = 0;
+  uint32_t latencyMaxUs_ = 0;
+};
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Scripted maneuvers, played back by the control tick instead of the phone.
+//
+// A script is a list of whitespace-separated steps:
+//
+//   g1 / g0        gas on / off
+//   t<deg>         steer to a tilt, e.g. t-20
+//   s<deg>,<ms>    sweep the tilt linearly from where it is to <deg> over <ms>
+//   w<ms>          wait
+//   l1 / l0        headlight on / off
+//   h              handbrake
+//   [ ... ]<n>     play the enclosed steps n times (no nesting)
+//
+// e.g. a 0-to-full launch:  g1 w3000 g0 w1500 h
+//      a slalom sweep:      g1 w600 [ s25,400 s-25,800 s0,400 ]4 g0 w1000 h
+//
+// Steps are scheduled on a script clock that only waits and sweeps advance,
+// and each step is applied on the first control tick at or after its
+// scheduled time. The player is stepped by whole control ticks, so a run
+// issues the same commands on the same ticks every time; use multiples of
+// the tick (motorUpdateIntervalMs) for exact timing. The gas is always
+// released when a script ends.
+
+constexpr size_t kManeuverMaxSteps = 64;
+constexpr size_t kManeuverMaxText = 512;                  // longest script accepted for upload
+constexpr uint32_t kManeuverMaxMs = 10u * 60u * 1000u;    // longest total run, loops included
+
+enum class ManeuverOp : uint8_t { Gas, Tilt, Sweep, Wait, Headlight, Handbrake, LoopStart, LoopEnd };
+
+struct ManeuverStep {
+  ManeuverOp op;
+  float value;    // Gas/Headlight: 0 or 1; Tilt/Sweep: degrees; LoopEnd: passes
+  uint32_t ms;    // Sweep/Wait duration
+};
+
+struct Maneuver {
+  ManeuverStep steps[kManeuverMaxSteps];
+  uint8_t count = 0;
+  uint32_t durationMs = 0;  // script time from start to end
+};
+
+// Parses `text` into `out`. Returns false, leaving `out` unspecified, if the
+// script is empty, too long or malformed.
+inline bool parseManeuver(const char *text, Maneuver &out) {
+  out.count = 0;
+  out.durationMs = 0;
+  bool inLoop = false;
+  uint32_t loopMs = 0;
+  uint64_t totalMs = 0;
+
+  auto isSeparator = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == ';'; };
+  auto readMs = [](const char *p, const char **end, uint32_t &ms) {
+    char *e = nullptr;
+    const unsigned long value = strtoul(p, &e, 10);
+    if (e == p || value == 0 || value > kManeuverMaxMs) return false;
+    ms = static_cast<uint32_t>(value);
+    *end = e;
+    return true;
+  };
+  auto readTilt = [](const char *p, const char **end, float &deg) {
+    char *e = nullptr;
+    deg = strtof(p, &e);
+    if (e == p || !std::isfinite(deg)) return false;
+    *end = e;
+    return true;
+  };
+
+  const char *p = text;
+  for (;;) {
+    while (isSeparator(*p)) ++p;
+    if (*p == '\0') break;
+    if (out.count == kManeuverMaxSteps) return false;
+
+    ManeuverStep step = {ManeuverOp::Wait, 0.0f, 0};
+    const char op = *p++;
+    const char *end = p;
+    switch (op) {
+      case 'g':
+      case 'l':
+        if (*p != '0' && *p != '1') return false;
+        step.op = op == 'g' ? ManeuverOp::Gas : ManeuverOp::Headlight;
+        step.value = *p == '1' ? 1.0f : 0.0f;
+        end = p + 1;
+        break;
+      case 'h':
+        step.op = ManeuverOp::Handbrake;
+        break;
+      case 't':
+        step.op = ManeuverOp::Tilt;
+        if (!readTilt(p, &end, step.value)) return false;
+        break;
+      case 's':
+        step.op = ManeuverOp::Sweep;
+        if (!readTilt(p, &end, step.value) || *end != ',' || !readMs(end + 1, &end, step.ms)) return false;
+        break;
+      case 'w':
+        step.op = ManeuverOp::Wait;
+        if (!readMs(p, &end, step.ms)) return false;
+        break;
+      case '[':
+        if (inLoop) return false;
+        inLoop = true;
+        loopMs = 0;
+        step.op = ManeuverOp::LoopStart;
+        break;
+      case ']': {
+        uint32_t passes = 0;
+        if (!inLoop || !readMs(p, &end, passes) || passes > 1000) return false;
+        inLoop = false;
+        step.op = ManeuverOp::LoopEnd;
+        step.value = static_cast<float>(passes);
+        totalMs += static_cast<uint64_t>(loopMs) * (passes - 1);
+        break;
+      }
+      default:
+        return false;
+    }
+    if (*end != '\0' && !isSeparator(*end)) return false;
+    p = end;
+
+    totalMs += step.ms;
+    if (inLoop) loopMs += step.ms;
+    if (totalMs > kManeuverMaxMs) return false;
+    out.steps[out.count++] = step;
+  }
+  if (inLoop || out.count == 0) return false;
+  out.durationMs = static_cast<uint32_t>(totalMs);
+  return true;
+}
+
+// Plays a Maneuver into a sink with the control path's entry points:
+//
+//   void tilt(float deg);  void gas(bool on);  void headlight(bool on);  void handbrake();
+//
+// The firmware's sink drives the same functions as the phone's frames; the
+// simulator's drives the plant.
+class ManeuverPlayer {
+public:
+  // `tilt` is the current steering tilt, where a leading sweep starts from.
+  void start(const Maneuver &maneuver, float tilt) {
+    maneuver_ = &maneuver;
+    pc_ = 0;
+    nowMs_ = 0;
+    cursorMs_ = 0;
+    loopPc_ = 0;
+    pass_ = 0;
+    tilt_ = tilt;
+    sweeping_ = false;
+    running_ = maneuver.count > 0;
+  }
+
+  // Stops without touching the outputs; the caller applies the handbrake.
+  void abort() { running_ = false; }
+
+  bool running() const { return running_; }
+
+  // Script time played so far.
+  uint32_t elapsedMs() const { return nowMs_; }
+
+  // One control tick: applies every step due at the current script time,
+  // then advances the script clock by `tickMs`.
+  template <typename Sink>
+  void tick(uint32_t tickMs, Sink &sink) {
+    if (!running_) return;
+    bool tiltChanged = false;
+    while (running_) {
+      if (sweeping_) {
+        if (nowMs_ < cursorMs_) {
+          const float progress =
+              static_cast<float>(nowMs_ - sweepStartMs_) / static_cast<float>(cursorMs_ - sweepStartMs_);
+          tilt_ = sweepFrom_ + (sweepTo_ - sweepFrom_) * progress;
+          tiltChanged = true;
+          break;
+        }
+        sweeping_ = false;
+        tilt_ = sweepTo_;
+        tiltChanged = true;
+      } else if (nowMs_ < cursorMs_) {
+        break;
+      }
+
+      if (pc_ == maneuver_->count) {
+        running_ = false;
+        break;
+      }
+      const ManeuverStep &step = maneuver_->steps[pc_++];
+      switch (step.op) {
+        case ManeuverOp::Gas:
+          sink.gas(step.value != 0.0f);
+          break;
+        case ManeuverOp::Headlight:
+          sink.headlight(step.value != 0.0f);
+          break;
+        case ManeuverOp::Handbrake:
+          sink.handbrake();
+          break;
+        case ManeuverOp::Tilt:
+          tilt_ = step.value;
+          tiltChanged = true;
+          break;
+        case ManeuverOp::Sweep:
+          sweeping_ = true;
+          sweepFrom_ = tilt_;
+          sweepTo_ = step.value;
+          sweepStartMs_ = cursorMs_;
+          cursorMs_ += step.ms;
+          break;
+        case ManeuverOp::Wait:
+          cursorMs_ += step.ms;
+          break;
+        case ManeuverOp::LoopStart:
+          loopPc_ = pc_;
+          pass_ = 0;
+          break;
+        case ManeuverOp::LoopEnd:
+          if (++pass_ < static_cast<uint32_t>(step.value)) pc_ = loopPc_;
+          break;
+      }
+    }
+    if (tiltChanged) sink.tilt(tilt_);
+    if (!running_) sink.gas(false);
+    nowMs_ += tickMs;
+  }
+
+private:
+  const Maneuver *maneuver_ = nullptr;
+  uint8_t pc_ = 0;
+  uint8_t loopPc_ = 0;
+  uint32_t pass_ = 0;
+  uint32_t nowMs_ = 0;     // script time of this tick
+  uint32_t cursorMs_ = 0;  // script time the next step is scheduled for
+  float tilt_ = 0.0f;
+  bool sweeping_ = false;
+  float sweepFrom_ = 0.0f;
+  float sweepTo_ = 0.0f;
+  uint32_t sweepStartMs_ = 0;
+  bool running_ = false;
+};
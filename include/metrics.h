@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Lightweight counter/gauge registry rendered in Prometheus text format.
+//
+// Metrics are declared as globals and link themselves into a registry list at
+// static-init time, in declaration order. Declare series that share a name
+// next to each other so HELP/TYPE is emitted once per family.
+//
+// Counter::inc() is a relaxed load and store, a handful of instructions and
+// no read-modify-write bus op. That assumes one writer per counter (the loop
+// task). Readers on other tasks see whole values.
+
+enum class MetricType : uint8_t { Counter, Gauge };
+
+class Metric {
+public:
+  Metric(const char *name, const char *labels, const char *help, MetricType type)
+      : name_(name), labels_(labels), help_(help), type_(type) {
+    if (tail() == nullptr) {
+      head() = this;
+    } else {
+      tail()->next_ = this;
+    }
+    tail() = this;
+  }
+
+  Metric(const Metric &) = delete;
+  Metric &operator=(const Metric &) = delete;
+
+  virtual uint32_t read() const = 0;
+
+  const char *name() const { return name_; }
+  const char *labels() const { return labels_; }
+  const char *help() const { return help_; }
+  MetricType type() const { return type_; }
+  const Metric *next() const { return next_; }
+
+  static const Metric *first() { return head(); }
+
+private:
+  static Metric *&head() {
+    static Metric *list = nullptr;
+    return list;
+  }
+  static Metric *&tail() {
+    static Metric *last = nullptr;
+    return last;
+  }
+
+  const char *name_;
+  const char *labels_;  // e.g. "command=\"sync\"", or "" for none
+  const char *help_;
+  MetricType type_;
+  Metric *next_ = nullptr;
+};
+
+class Counter : public Metric {
+public:
+  Counter(const char *name, const char *labels, const char *help) : Metric(name, labels, help, MetricType::Counter) {}
+
+  void inc(uint32_t n = 1) { value_.store(value_.load(std::memory_order_relaxed) + n, std::memory_order_relaxed); }
+  uint32_t read() const override { return value_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint32_t> value_{0};
+};
+
+class Gauge : public Metric {
+public:
+  Gauge(const char *name, const char *labels, const char *help) : Metric(name, labels, help, MetricType::Gauge) {}
+
+  void set(uint32_t v) { value_.store(v, std::memory_order_relaxed); }
+  uint32_t read() const override { return value_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint32_t> value_{0};
+};
+
+// A gauge (or externally maintained counter) sampled only when /metrics is
+// scraped, e.g. free heap. Costs nothing on the hot path.
+class CallbackMetric : public Metric {
+public:
+  using ReadFn = uint32_t (*)();
+  CallbackMetric(const char *name, const char *labels, const char *help, MetricType type, ReadFn fn)
+      : Metric(name, labels, help, type), fn_(fn) {}
+
+  uint32_t read() const override { return fn_(); }
+
+private:
+  ReadFn fn_;
+};
+
+// Appends every registered metric to `out` in Prometheus text format 0.0.4.
+inline void renderPrometheus(std::string &out) {
+  const char *family = nullptr;
+  char line[160];
+  for (const Metric *m = Metric::first(); m != nullptr; m = m->next()) {
+    if (family == nullptr || strcmp(family, m->name()) != 0) {
+      family = m->name();
+      snprintf(line, sizeof(line), "# HELP %s %s\n# TYPE %s %s\n", m->name(), m->help(), m->name(),
+               m->type() == MetricType::Counter ? "counter" : "gauge");
+      out += line;
+    }
+    if (m->labels()[0] != '\0') {
+      snprintf(line, sizeof(line), "%s{%s} %lu\n", m->name(), m->labels(), static_cast<unsigned long>(m->read()));
+    } else {
+      snprintf(line, sizeof(line), "%s %lu\n", m->name(), static_cast<unsigned long>(m->read()));
+    }
+    out += line;
+  }
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+
+// WebSocket text protocol between the web UI and the car.
+
+enum class Command : uint8_t {
+  Sync,
+  GasOn,
+  GasOff,
+  Handbrake,
+  HeadlightOn,
+  HeadlightOff,
+  Hello,
+  Pong,
+  Maneuver,
+  ManeuverRun,
+  Tilt,
+  Invalid,
+};
+
+// "hello:<client id>" is the first frame of a session. The id is random per
+// browser tab and lets a reconnecting driver reclaim the reserved slot.
+constexpr char kHelloPrefix[] = "hello:";
+constexpr size_t kHelloPrefixLen = sizeof(kHelloPrefix) - 1;
+
+// "maneuver:<script>" uploads a maneuver script (see maneuver.h);
+// "maneuver_run" plays the stored one.
+constexpr char kManeuverPrefix[] = "maneuver:";
+constexpr size_t kManeuverPrefixLen = sizeof(kManeuverPrefix) - 1;
+
+// Parses one client frame. For Command::Tilt the value is stored in `tilt`.
+inline Command parseCommand(const std::string &message, float &tilt) {
+  if (message == "sync") return Command::Sync;
+  if (message == "gas_on") return Command::GasOn;
+  if (message == "gas_off") return Command::GasOff;
+  if (message == "handbrake") return Command::Handbrake;
+  if (message == "headlight_on") return Command::HeadlightOn;
+  if (message == "headlight_off") return Command::HeadlightOff;
+  if (message.compare(0, kHelloPrefixLen, kHelloPrefix) == 0) return Command::Hello;
+  if (message == "pong") return Command::Pong;
+  if (message.compare(0, kManeuverPrefixLen, kManeuverPrefix) == 0) return Command::Maneuver;
+  if (message == "maneuver_run") return Command::ManeuverRun;
+
+  char *endPtr = nullptr;
+  const float value = strtof(message.c_str(), &endPtr);
+  if (endPtr == message.c_str() || !std::isfinite(value)) return Command::Invalid;
+  tilt = value;
+  return Command::Tilt;
+}
+
+struct CarState {
+  int angle;
+  float tilt;
+  float motorDuty;
+  bool gas;
+  bool headlight;
+};
+
+// Large enough for the widest frame, including a clamped out-of-range tilt.
+constexpr size_t kStateFrameMax = 112;
+
+// Formatting helpers used instead of snprintf("%f"), which is slow on the ESP32.
+inline char *appendLiteral(char *out, const char *text) {
+  while (*text != '\0') *out++ = *text++;
+  return out;
+}
+
+inline char *appendUInt(char *out, uint32_t value) {
+  char digits[10];
+  int n = 0;
+  do {
+    digits[n++] = static_cast<char>('0' + value % 10u);
+    value /= 10u;
+  } while (value != 0u);
+  while (n > 0) *out++ = digits[--n];
+  return out;
+}
+
+inline char *appendInt(char *out, int32_t value) {
+  if (value < 0) {
+    *out++ = '-';
+    return appendUInt(out, static_cast<uint32_t>(-static_cast<int64_t>(value)));
+  }
+  return appendUInt(out, static_cast<uint32_t>(value));
+}
+
+// Writes `value` rounded to `decimals` places, e.g. (-1.5f, 2) -> "-1.50".
+inline char *appendFixed(char *out, float value, int decimals) {
+  int32_t scale = 1;
+  for (int i = 0; i < decimals; ++i) scale *= 10;
+  const float limit = 2.0e9f / static_cast<float>(scale);
+  if (value > limit) value = limit;
+  if (value < -limit) value = -limit;
+
+  const int32_t scaled = static_cast<int32_t>(lroundf(value * static_cast<float>(scale)));
+  uint32_t magnitude = scaled < 0 ? static_cast<uint32_t>(-static_cast<int64_t>(scaled)) : static_cast<uint32_t>(scaled);
+  if (scaled < 0) *out++ = '-';
+  out = appendUInt(out, magnitude / static_cast<uint32_t>(scale));
+  *out++ = '.';
+  uint32_t frac = magnitude % static_cast<uint32_t>(scale);
+  for (int32_t div = scale / 10; div > 0; div /= 10) {
+    *out++ = static_cast<char>('0' + frac / static_cast<uint32_t>(div));
+    frac %= static_cast<uint32_t>(div);
+  }
+  return out;
+}
+
+// Writes the state frame sent to clients. Returns the length, or -1 if `size`
+// is smaller than kStateFrameMax. The output is NUL-terminated.
+inline int formatState(char *out, size_t size, const CarState &state) {
+  if (size < kStateFrameMax) return -1;
+  char *p = out;
+  p = appendLiteral(p, "{\"angle\":");
+  p = appendInt(p, state.angle);
+  p = appendLiteral(p, ",\"tilt\":");
+  p = appendFixed(p, state.tilt, 2);
+  p = appendLiteral(p, ",\"motorDuty\":");
+  p = appendFixed(p, state.motorDuty, 3);
+  p = appendLiteral(p, state.gas ? ",\"gas\":true" : ",\"gas\":false");
+  p = appendLiteral(p, state.headlight ? ",\"headlight\":true}" : ",\"headlight\":false}");
+  *p = '\0';
+  return static_cast<int>(p - out);
+}
+
+// Sent on every gas edge (and on sync). The UI extrapolates the motor duty
+// from it: duty + (gas ? accel : -decel) * ms since the frame arrived, clamped
+// to 0..dutyMax, so the server does not have to stream the ramp.
+struct RampParams {
+  float duty;
+  bool gas;
+  float accelPerMs;
+  float decelPerMs;
+  float dutyMax;  // where the ramp stops, the profile's motorDutyMax
+};
+
+constexpr size_t kRampFrameMax = 112;
+
+// Writes the ramp frame. Returns the length, or -1 if `size` is smaller than
+// kRampFrameMax. The output is NUL-terminated.
+inline int formatRamp(char *out, size_t size, const RampParams &ramp) {
+  if (size < kRampFrameMax) return -1;
+  char *p = out;
+  p = appendLiteral(p, "{\"ramp\":{\"duty\":");
+  p = appendFixed(p, ramp.duty, 3);
+  p = appendLiteral(p, ramp.gas ? ",\"gas\":true" : ",\"gas\":false");
+  p = appendLiteral(p, ",\"accel\":");
+  p = appendFixed(p, ramp.accelPerMs, 6);
+  p = appendLiteral(p, ",\"decel\":");
+  p = appendFixed(p, ramp.decelPerMs, 6);
+  p = appendLiteral(p, ",\"max\":");
+  p = appendFixed(p, ramp.dutyMax, 3);
+  p = appendLiteral(p, "}}");
+  *p = '\0';
+  return static_cast<int>(p - out);
+}
+
+// An encoded state frame. Immutable once built and shared by every client it
+// is sent to.
+struct StateFrame {
+  CarState state;
+  uint16_t length;
+  char data[kStateFrameMax];
+};
+
+using StateFramePtr = std::shared_ptr<const StateFrame>;
+
+// True when both states encode to the same frame.
+inline bool sameFrame(const CarState &a, const CarState &b) {
+  return a.angle == b.angle && lroundf(a.tilt * 100.0f) == lroundf(b.tilt * 100.0f) &&
+         lroundf(a.motorDuty * 1000.0f) == lroundf(b.motorDuty * 1000.0f) && a.gas == b.gas &&
+         a.headlight == b.headlight;
+}
+
+// Encodes the state once per visible change and hands out the shared frame.
+class StateFrameCache {
+public:
+  StateFramePtr get(const CarState &state) {
+    if (frame_ && sameFrame(frame_->state, state)) return frame_;
+    auto frame = std::make_shared<StateFrame>();
+    frame->state = state;
+    frame->length = static_cast<uint16_t>(formatState(frame->data, sizeof(frame->data), state));
+    frame_ = frame;
+    ++encodes_;
+    return frame_;
+  }
+
+  uint32_t encodes() const { return encodes_; }
+
+private:
+  StateFramePtr frame_;
+  uint32_t encodes_ = 0;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+
+// Closed-loop speed control from a wheel encoder. Hardware-free; the firmware
+// feeds it pulse counts from the PCNT peripheral, the native simulator feeds
+// it pulses from a plant model.
+
+struct SpeedGains {
+  float maxSpeedMps;     // speed requested at full throttle
+  float kff;             // feed-forward duty per unit of target/maxSpeed
+  float kp;              // duty per unit of error/maxSpeed
+  float ki;              // duty per second per unit of error/maxSpeed
+  float launchAccelMps2; // fastest target rise, what the car can really do
+  float slipAccelMps2;   // wheel acceleration above this is wheelspin
+  float slipCut;         // launch rate scale applied on each wheelspin tick
+  float slipRecoverPerS; // launch rate scale regained per second without wheelspin
+  float dutyMax;         // highest duty the motor output takes
+};
+
+// The gains of a vehicle profile (see vehicle_profiles.h).
+template <typename P>
+constexpr SpeedGains speedGainsFor() {
+  return SpeedGains{P::speedMaxMps,     P::speedKff,      P::speedKp, P::speedKi,
+                    P::launchAccelMps2, P::slipAccelMps2, P::slipCut, P::slipRecoverPerS,
+                    P::motorDutyMax};
+}
+
+// Wheel speed from encoder pulses, averaged over the last kWindow control
+// ticks so a low-resolution encoder still gives a usable reading.
+class EncoderSpeed {
+public:
+  static constexpr int kWindow = 4;
+
+  explicit EncoderSpeed(float pulsesPerMeter) : pulsesPerMeter_(pulsesPerMeter) {}
+
+  float update(uint32_t pulses, uint32_t dtMs) {
+    pulseSum_ += pulses - pulses_[next_];
+    msSum_ += dtMs - ms_[next_];
+    pulses_[next_] = pulses;
+    ms_[next_] = dtMs;
+    next_ = (next_ + 1) % kWindow;
+    return msSum_ == 0 ? 0.0f : 1000.0f * static_cast<float>(pulseSum_) / (pulsesPerMeter_ * msSum_);
+  }
+
+private:
+  float pulsesPerMeter_;
+  uint32_t pulses_[kWindow] = {};
+  uint32_t ms_[kWindow] = {};
+  uint32_t pulseSum_ = 0;
+  uint32_t msSum_ = 0;
+  int next_ = 0;
+};
+
+// Feed-forward + PI speed loop with launch and traction limiting.
+//
+// The throttle (0..1, see speedRequest() in control.h) is a speed request.
+// The target is rate-limited to launchAccelMps2, so a stab of full throttle
+// does not just dump full duty.
+// If the measured wheel speed still rises faster than slipAccelMps2, the
+// wheels are spinning: the target drops back to the last grip-limited speed
+// and the launch rate is scaled down by slipCut, recovering slowly, so the
+// loop settles on the rate the surface allows.
+class SpeedController {
+public:
+  explicit SpeedController(const SpeedGains &gains) : g_(gains) {}
+
+  void reset() {
+    target_ = 0.0f;
+    integral_ = 0.0f;
+    lastMeasured_ = 0.0f;
+    launchScale_ = 1.0f;
+    slipping_ = false;
+  }
+
+  // Returns the motor duty (0..dutyMax) for this control tick.
+  float update(float throttle, float measuredMps, uint32_t dtMs) {
+    const float dt = static_cast<float>(dtMs) / 1000.0f;
+    const float wanted = throttle * g_.maxSpeedMps;
+    if (wanted <= 0.0f) {
+      reset();
+      return 0.0f;
+    }
+
+    // After wheelspin the climb rate stays reduced until traction recovers.
+    const float maxRise = g_.launchAccelMps2 * launchScale_ * dt;
+    target_ = wanted < target_ + maxRise ? wanted : target_ + maxRise;
+
+    const float wheelAccel = dt > 0.0f ? (measuredMps - lastMeasured_) / dt : 0.0f;
+    slipping_ = wheelAccel > g_.slipAccelMps2;
+    if (slipping_) {
+      // The car is still near the last reading; restart the climb from there.
+      if (target_ > lastMeasured_) target_ = lastMeasured_;
+      launchScale_ *= g_.slipCut;
+    } else {
+      launchScale_ += g_.slipRecoverPerS * dt;
+      if (launchScale_ > 1.0f) launchScale_ = 1.0f;
+    }
+    lastMeasured_ = measuredMps;
+
+    const float error = (target_ - measuredMps) / g_.maxSpeedMps;
+    const float base = g_.kff * target_ / g_.maxSpeedMps + g_.kp * error;
+    const float integral = integral_ + g_.ki * error * dt;
+    float duty = base + integral;
+    // Conditional integration: only keep the new integral if it does not push
+    // further into saturation, and never while the wheels are spinning.
+    const bool saturatedHigh = duty > g_.dutyMax && error > 0.0f;
+    const bool saturatedLow = duty < 0.0f && error < 0.0f;
+    if (!saturatedHigh && !saturatedLow && !slipping_) integral_ = integral;
+    duty = base + integral_;
+
+    if (duty < 0.0f) duty = 0.0f;
+    if (duty > g_.dutyMax) duty = g_.dutyMax;
+    return duty;
+  }
+
+  float target() const { return target_; }
+  bool slipping() const { return slipping_; }
+
+private:
+  SpeedGains g_;
+  float target_ = 0.0f;
+  float integral_ = 0.0f;
+  float lastMeasured_ = 0.0f;
+  float launchScale_ = 1.0f;
+  bool slipping_ = false;
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+
+// Heap cost of a TLS connection, measured on the running board.
+//
+// Most of a connection's heap is mbedTLS state plus its input and output record
+// buffers, whose sizes are fixed by the framework's mbedTLS build. The cost is
+// therefore measured instead of assumed. The free heap is sampled whenever the
+// number of open connections changes: the free heap with none open is the
+// baseline, and the drop from it divided by the open count is the cost of one
+// connection. The baseline is re-taken every time the count returns to zero
+// and the latest cost replaces the previous one, so heap the rest of the
+// firmware takes or frees between connections does not stick to the estimate.
+//
+// Only sample once the network is fully up; allocations made while Wi-Fi is
+// still starting would otherwise be charged to the first connection.
+class ConnectionHeapModel {
+public:
+  void sample(uint8_t openConnections, uint32_t freeHeap) {
+    if (openConnections == 0) {
+      baselineFree_ = freeHeap;
+      return;
+    }
+    if (baselineFree_ == 0 || freeHeap >= baselineFree_) return;
+    perConnection_ = (baselineFree_ - freeHeap) / openConnections;
+  }
+
+  // 0 until a connection has been measured.
+  uint32_t perConnectionBytes() const { return perConnection_; }
+
+  // Connections that fit in total, open ones included, keeping `reserveBytes`
+  // free for the handshake of the next one and for Wi-Fi/lwIP buffers.
+  uint32_t capacity(uint8_t openConnections, uint32_t freeHeap, uint32_t reserveBytes) const {
+    if (perConnection_ == 0) return 0;
+    const uint32_t spare = freeHeap > reserveBytes ? freeHeap - reserveBytes : 0;
+    return openConnections + spare / perConnection_;
+  }
+
+  // False if accepting one more connection would eat into the reserve.
+  // Before the first measurement, connections are only bounded by slots.
+  bool admitAnother(uint32_t freeHeap, uint32_t reserveBytes) const {
+    return perConnection_ == 0 || freeHeap >= reserveBytes + perConnection_;
+  }
+
+private:
+  uint32_t baselineFree_ = 0;
+  uint32_t perConnection_ = 0;
+};
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+// Per-chassis constants. A profile is a struct of static constexpr members.
+// Each build selects one with -DVEHICLE_PROFILE=<struct> (see platformio.ini
+// and car_config.h). The control code in control.h is templated on the profile,
+// so steering inversion, ranges and lookup-table sizes are fixed at compile
+// time and checked by VehicleChecks in car_config.h.
+//
+// To add a chassis, copy a profile, adjust it, and add a PlatformIO env that
+// builds with it.
+
+// The original buggy. The steering servo is mounted upside down, and a MOSFET
+// drives a brushed motor.
+struct BuggyProfile {
+  // ====== Steering ======
+  static constexpr int servoPin = 19;           // GPIO connected to servo signal
+  static constexpr int servoMin = 40;           // Servo angle minimum
+  static constexpr int servoMax = 130;          // Servo angle maximum
+  static constexpr int servoPulseMinUs = 922;   // Pulse width for servoMin
+  static constexpr int servoPulseMaxUs = 1872;  // Pulse width for servoMax
+  static constexpr bool invertSteering = true;  // tilt right drives towards servoMin
+  static constexpr float tiltMin = -45.0f;      // phone tilt min (degrees)
+  static constexpr float tiltMax = +45.0f;      // phone tilt max
+
+  // ====== Drive ======
+  static constexpr int motorPwmPin = 18;        // GPIO connected to ESC / motor driver input
+  static constexpr int headlightPin = 33;       // GPIO connected to headlight
+  static constexpr uint32_t motorFreq = 20000;  // 20 kHz to keep motor drive quiet
+  static constexpr uint8_t motorResolution = 11; // most the 80 MHz LEDC clock allows at 20 kHz
+  static constexpr float motorDutyMax = 1.0f;
+  static constexpr float motorAccelPerMs = 1.0f / 600.0f; // reach full throttle in ~0.6s
+  static constexpr float motorDecelPerMs = 1.0f / 900.0f; // coast down a bit slower
+
+  // ====== Wheel encoder / speed control ======
+  // With an encoder the throttle requests a speed and a closed loop holds it
+  // through battery sag and surface changes. -1 keeps open-loop duty.
+  static constexpr int encoderPin = -1;                  // GPIO for the encoder pulse output, -1 = none
+  static constexpr float encoderPulsesPerMeter = 200.0f; // pulses per metre of wheel travel
+  static constexpr uint16_t encoderGlitchFilter = 1000;  // ignore pulses shorter than this many APB ticks (12.5 us)
+  static constexpr float speedMaxMps = 5.0f;             // speed requested at full throttle
+  static constexpr float speedKff = 0.7f;                // duty per unit of requested speed / speedMaxMps
+  static constexpr float speedKp = 0.8f;
+  static constexpr float speedKi = 3.0f;                 // per second
+  static constexpr float launchAccelMps2 = 4.0f;         // target speed rises no faster than the car can
+  static constexpr float slipAccelMps2 = 9.0f;           // wheel accelerating faster than this is wheelspin
+  static constexpr float slipCut = 0.8f;                 // launch rate scale per wheelspin tick
+  static constexpr float slipRecoverPerS = 0.5f;         // launch rate scale regained per second once gripping
+};
+
+// Crawler. The servo is mounted the right way up with a narrower throw. A
+// hobby ESC needs a lower PWM rate, and the car runs closed loop on a
+// motor-shaft encoder.
+struct CrawlerProfile {
+  // ====== Steering ======
+  static constexpr int servoPin = 19;
+  static constexpr int servoMin = 55;
+  static constexpr int servoMax = 125;
+  static constexpr int servoPulseMinUs = 1110;
+  static constexpr int servoPulseMaxUs = 1890;
+  static constexpr bool invertSteering = false;
+  static constexpr float tiltMin = -35.0f;
+  static constexpr float tiltMax = +35.0f;
+
+  // ====== Drive ======
+  static constexpr int motorPwmPin = 18;
+  static constexpr int headlightPin = 33;
+  static constexpr uint32_t motorFreq = 1000;    // ESC input filter tops out around 2 kHz
+  static constexpr uint8_t motorResolution = 14;
+  static constexpr float motorDutyMax = 0.8f;    // gearing makes full duty pointless; full throttle still asks speedMaxMps
+  static constexpr float motorAccelPerMs = 1.0f / 1500.0f;
+  static constexpr float motorDecelPerMs = 1.0f / 600.0f;
+
+  // ====== Wheel encoder / speed control ======
+  static constexpr int encoderPin = 34;
+  static constexpr float encoderPulsesPerMeter = 1400.0f;
+  static constexpr uint16_t encoderGlitchFilter = 400;
+  static constexpr float speedMaxMps = 1.5f;
+  static constexpr float speedKff = 0.5f;
+  static constexpr float speedKp = 0.6f;
+  static constexpr float speedKi = 2.0f;
+  static constexpr float launchAccelMps2 = 1.5f;
+  static constexpr float slipAccelMps2 = 4.0f;
+  static constexpr float slipCut = 0.8f;
+  static constexpr float slipRecoverPerS = 0.5f;
+};
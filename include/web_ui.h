@@ -1,609 +1,404 @@
 #pragma once
 
-static const char WEB_UI_HTML[] = R"HTMLDOC(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-  <meta charset="utf-8">
-  <meta name="viewport" content="width=device-width, initial-scale=1, viewport-fit=cover">
-  <title>RC Car Control</title>
-  <style>
-    :root {
-      color-scheme: dark;
-      --card-bg: rgba(16, 24, 39, 0.8);
-      --card-border: rgba(255, 255, 255, 0.08);
-      --accent: #4fc3f7;
-      --accent-strong: #00bcd4;
-      --warning: #ffb74d;
-    }
-
-    * { box-sizing: border-box; }
-
-    body {
-      margin: 0;
-      font-family: 'SF Pro Display', 'Inter', Arial, sans-serif;
-      background: #071428;
-      color: #f6f9ff;
-      min-height: 100vh;
-      display: flex;
-      align-items: stretch;
-      justify-content: center;
-      padding: clamp(16px, 4vw, 32px);
-    }
-
-    @media (orientation: landscape) {
-      body {
-        padding: 0;
-      }
-    }
-
-    main {
-      width: min(1100px, 100%);
-      backdrop-filter: blur(16px);
-      border: 1px solid var(--card-border);
-      border-radius: 24px;
-      background: rgba(3, 7, 18, 0.65);
-      box-shadow: 0 20px 60px rgba(2, 6, 23, 0.75);
-      padding: clamp(20px, 4vw, 36px);
-      display: flex;
-      flex-direction: column;
-      gap: 24px;
-      align-items: stretch;
-    }
-
-    @media (orientation: landscape) {
-      main {
-        width: 100vw;
-        height: 100vh;
-        border-radius: 0;
-        border: none;
-        padding: 20px;
-        gap: 16px;
-      }
-    }
-
-    .control-grid {
-      display: flex;
-      gap: 24px;
-      align-items: stretch;
-      flex: 1 1 0;
-    }
-
-    .column {
-      flex: 1;
-      display: flex;
-      flex-direction: column;
-      gap: 24px;
-    }
-
-    .mid-column {
-      flex: 0 0 200px;
-      justify-content: center;
-    }
-
-    .throttle-column {
-      flex: 0 0 320px;
-    }
-
-    h1 {
-      font-size: clamp(1.2rem, 3vw, 1.8rem);
-      margin: 0;
-    }
-
-    #status {
-      font-size: 0.9rem;
-      color: var(--warning);
-    }
-
-    .button-row {
-      display: flex;
-      flex-wrap: wrap;
-      gap: 12px;
-    }
-
-    button {
-      font-size: 1rem;
-      padding: 12px 24px;
-      border-radius: 999px;
-      border: 1px solid transparent;
-      color: #041021;
-      background: var(--accent);
-      cursor: pointer;
-      transition: transform 0.2s ease, box-shadow 0.2s ease, background 0.2s ease;
-    }
-
-    button:hover {
-      transform: translateY(-1px);
-      box-shadow: 0 10px 20px rgba(79, 195, 247, 0.25);
-    }
-
-    button:active, button.active {
-      background: var(--accent-strong);
-    }
-
-    button:disabled {
-      opacity: 0.4;
-      cursor: not-allowed;
-    }
-
-    .throttle-card {
-      align-items: center;
-      text-align: center;
-      justify-content: center;
-    }
-
-    .throttle-title {
-      font-size: 1.1rem;
-      letter-spacing: 0.08em;
-      text-transform: uppercase;
-      color: rgba(255, 255, 255, 0.7);
-    }
-
-    .throttle-buttons {
-      display: flex;
-      flex-direction: column;
-      gap: 20px;
-      align-items: center;
-    }
-
-    .circle-button {
-      width: 120px;
-      height: 120px;
-      border-radius: 50%;
-      display: flex;
-      align-items: center;
-      justify-content: center;
-      font-size: 1.1rem;
-      padding: 0;
-      border: 2px solid rgba(255, 255, 255, 0.25);
-      color: #fff;
-      font-weight: 600;
-    }
-
-    .gas-btn {
-      background: #2196f3;
-    }
-
-    .brake-btn {
-      background: #f44336;
-    }
-
-    .circle-button:active, .circle-button.active {
-      opacity: 0.8;
-    }
-
-    section.card {
-      border-radius: 20px;
-      border: 1px solid var(--card-border);
-      background: var(--card-bg);
-      padding: clamp(16px, 3vw, 28px);
-      display: flex;
-      flex-direction: column;
-      flex: 1;
-    }
-
-    .steering-value {
-      font-size: 1.2rem;
-      font-weight: 600;
-    }
-
-    .steering-wheel {
-      width: 120px;
-      height: 120px;
-      position: relative; /* ensure arrow is positioned relative to the wheel */
-      background: #041026;
-      border-radius: 50%;
-      border: 1px solid rgba(255,255,255,0.06);
-    }
-
-    .steering-arrow {
-      position: absolute;
-      left: 50%;
-      top: 50%;
-      width: 0;
-      height: 0;
-      border-left: 12px solid transparent;
-      border-right: 12px solid transparent;
-      border-bottom: 24px solid #4fc3f7;
-      transform-origin: 50% 50%;
-      transform: translate(-50%, -50%) rotate(var(--angle, 0deg));
-    }
-
-    #tiltSlider {
-      width: 100%;
-      appearance: none;
-      height: 12px;
-      border-radius: 999px;
-      background: rgba(255, 255, 255, 0.15);
-      outline: none;
-    }
-
-    #tiltSlider::-webkit-slider-thumb {
-      appearance: none;
-      width: 26px;
-      height: 26px;
-      border-radius: 50%;
-      background: var(--accent);
-      box-shadow: 0 6px 20px rgba(79, 195, 247, 0.45);
-      border: 2px solid rgba(255, 255, 255, 0.5);
-    }
-
-    #tiltSlider::-moz-range-thumb {
-      width: 26px;
-      height: 26px;
-      border-radius: 50%;
-      background: var(--accent);
-      border: none;
-    }
-
-    section.card p {
-      font-size: 0.9rem;
-      margin: 8px 0;
-    }
-
-    #gyroStatus {
-      font-size: 0.8rem;
-      color: rgba(255, 255, 255, 0.7);
-      min-height: 1.4rem;
-    }
-
-    .motor-meter {
-      width: 40px;
-      height: 200px;
-      border-radius: 20px;
-      background: #0d47a1;
-      overflow: hidden;
-      border: 1px solid rgba(255, 255, 255, 0.2);
-      margin: 0 auto;
-      position: relative;
-    }
-
-    #motorDutyBar {
-      width: 100%;
-      height: 0%;
-      background: #ffd700;
-      position: absolute;
-      bottom: 0;
-      transition: height 0.2s ease;
-    }
-
-    .duty-title {
-      font-size: 1.1rem;
-      letter-spacing: 0.08em;
-      text-transform: uppercase;
-      color: rgba(255, 255, 255, 0.7);
-      text-align: center;
-    }
-
-    @media (orientation: portrait) or (max-width: 900px) {
-      .circle-button {
-        width: 60px;
-        height: 60px;
-        font-size: 0.8rem;
-      }
-
-      .motor-meter {
-        width: 24px;
-        height: 120px;
-      }
-
-      .steering-wheel {
-        width: 120px;
-        height: 120px;
-      }
-
-      .steering-arrow {
-        border-left-width: 8px;
-        border-right-width: 8px;
-        border-bottom-width: 16px;
-        top: 20px;
-        transform-origin: 8px 16px;
-      }
-    }
-
-    @media (max-width: 600px) {
-      main { border-radius: 16px; }
-      button { flex: 1; text-align: center; }
-    }
-  </style>
-</head>
-<body>
-  <main>
-    <header>
-      <div>
-        <h1>RC Car Controller</h1>
-        <p id="status">Connecting…</p>
-      </div>
-      <div class="button-row">
-        <button id="gyroButton" type="button">Zero Gyro</button>
-        <button id="headlightButton" type="button">Headlight</button>
-      </div>
-      <p id="gyroStatus">Tap “Zero Gyro” to grant motion access and calibrate the current wheel position.</p>
-    </header>
-
-    <div class="control-grid">
-      <div class="column steering-column">
-        <section class="card steering-card">
-          <div class="steering-wheel" id="steeringWheel">
-            <div class="steering-arrow" id="steeringArrow"></div>
-          </div>
-          <div class="steering-value" id="angleDisplay">Steering: 90°</div>
-          <input type="range" min="-45" max="45" step="0.1" value="0" id="tiltSlider">
-          <p>Slide or tilt (landscape) to steer.</p>
-        </section>
-      </div>
-
-      <div class="column mid-column">
-        <section class="card duty-card">
-          <div class="duty-title">Motor Power</div>
-          <div class="motor-meter"><div id="motorDutyBar"></div></div>
-          <p id="motorDisplay">0%</p>
-        </section>
-      </div>
-
-      <div class="column throttle-column">
-        <section class="card throttle-card">
-          <div class="throttle-title">Throttle</div>
-          <div class="throttle-buttons">
-            <button class="circle-button gas-btn" id="gasButton" type="button">Gas</button>
-            <button class="circle-button brake-btn" id="handbrakeButton" type="button">Brake</button>
-          </div>
-          <p>Hold Gas to accelerate. Tap Brake to cut power.</p>
-        </section>
-      </div>
-    </div>
-  </main>
-
-  <script>
-    const slider = document.getElementById('tiltSlider');
-    const statusEl = document.getElementById('status');
-    const angleEl = document.getElementById('angleDisplay');
-    const steeringWheel = document.getElementById('steeringWheel');
-    const gasButton = document.getElementById('gasButton');
-    const handbrakeButton = document.getElementById('handbrakeButton');
-    const motorEl = document.getElementById('motorDisplay');
-    const motorDutyBar = document.getElementById('motorDutyBar');
-    const gyroButton = document.getElementById('gyroButton');
-    const gyroStatusEl = document.getElementById('gyroStatus');
-    const headlightButton = document.getElementById('headlightButton');
-    let ws;
-    let gasHeld = false;
-    let gyroEnabled = false;
-    let gyroRequestInFlight = false;
-    let lastTiltSent = parseFloat(slider.value);
-    let lastRawWheel = 0;
-    let gyroZeroOffset = 0;
-    let headlightOn = false;
-
-    const setSteeringIndicator = (tiltDegrees) => {
-      const arrow = document.getElementById('steeringArrow');
-      if (arrow) arrow.style.setProperty('--angle', `${tiltDegrees * 2}deg`);
-    };
-
-    const sendCommand = (payload) => {
-      if (ws && ws.readyState === WebSocket.OPEN) {
-        ws.send(payload);
-      }
-    };
-
-    const clamp = (value, min, max) => Math.min(max, Math.max(min, value));
-
-    const updateFullscreenLabel = () => {
-      // Removed for iOS compatibility
-    };
-
-    const toggleFullscreen = () => {
-      // Not supported on iOS Safari
-    };
-
-    // Fullscreen not used on iOS; no-op placeholder kept for compatibility.
-
-    const isLandscapeOrientation = () => {
-      if (window.screen?.orientation && typeof window.screen.orientation.angle === 'number') {
-        return Math.abs(window.screen.orientation.angle) === 90;
-      }
-      if (typeof window.orientation === 'number') {
-        return Math.abs(window.orientation) === 90;
-      }
-      return window.innerWidth > window.innerHeight;
-    };
-
-    const computeWheelRotation = (event) => {
-      if (isLandscapeOrientation() && typeof event.beta === 'number') {
-        return event.beta;
-      }
-      if (typeof event.gamma === 'number') {
-        return event.gamma;
-      }
-      if (typeof event.beta === 'number') {
-        return event.beta;
-      }
-      return 0;
-    };
-
-    const handleOrientation = (event) => {
-      if (!gyroEnabled) return;
-      const rawWheel = computeWheelRotation(event);
-      lastRawWheel = rawWheel;
-      const tilt = clamp(rawWheel - gyroZeroOffset, -45, 45);
-      if (Math.abs(tilt - lastTiltSent) < 0.5) return;
-      slider.value = tilt.toFixed(1);
-      lastTiltSent = tilt;
-      setSteeringIndicator(tilt);
-      sendCommand(tilt.toFixed(2));
-    };
-
-    const startGyroStream = () => {
-      if (gyroEnabled) return;
-      window.addEventListener('deviceorientation', handleOrientation);
-      gyroEnabled = true;
-      gyroStatusEl.textContent = 'Gyro ready. Tap “Zero Gyro” any time to recenter the steering wheel.';
-    };
-
-    const ensureGyroAccess = () => {
-      if (gyroEnabled) return Promise.resolve();
-      if (gyroRequestInFlight) return Promise.reject(new Error('pending'));
-      gyroRequestInFlight = true;
-      gyroStatusEl.textContent = 'Requesting motion access…';
-
-      return new Promise((resolve, reject) => {
-        if (typeof DeviceOrientationEvent === 'undefined') {
-          gyroRequestInFlight = false;
-          reject(new Error('unsupported'));
-          return;
-        }
-
-        const onGranted = () => {
-          gyroRequestInFlight = false;
-          startGyroStream();
-          resolve();
-        };
-
-        const onDenied = (err) => {
-          gyroRequestInFlight = false;
-          reject(err);
-        };
-
-        if (typeof DeviceOrientationEvent.requestPermission === 'function') {
-          DeviceOrientationEvent.requestPermission()
-            .then((state) => {
-              if (state === 'granted') {
-                onGranted();
-              } else {
-                onDenied(new Error('denied'));
-              }
-            })
-            .catch(onDenied);
-        } else {
-          onGranted();
-        }
-      });
-    };
-
-    const zeroGyro = () => {
-      gyroZeroOffset = lastRawWheel;
-      gyroStatusEl.textContent = 'Steering centered. Rotate the device like a wheel.';
-    };
-
-    const handleZeroButton = () => {
-      ensureGyroAccess()
-        .then(() => {
-          zeroGyro();
-        })
-        .catch((err) => {
-          console.error('Gyro access error', err);
-          if (err?.message === 'unsupported') {
-            gyroStatusEl.textContent = 'Device orientation not supported. Use the slider instead.';
-          } else if (err?.message === 'denied') {
-            gyroStatusEl.textContent = 'Motion access denied. Check Safari Settings ▸ Motion & Orientation.';
-          } else if (err?.message === 'pending') {
-            gyroStatusEl.textContent = 'Motion access already requested…';
-          } else {
-            gyroStatusEl.textContent = 'Unable to start gyro. Try again.';
-          }
-        });
-    };
-
-    function connectWs() {
-      const proto = location.protocol === 'https:' ? 'wss://' : 'ws://';
-      ws = new WebSocket(proto + location.host + '/ws');
-
-      ws.onopen = () => {
-        statusEl.textContent = 'Connected';
-        sendCommand('sync');
-      };
-
-      ws.onclose = () => {
-        statusEl.textContent = 'Disconnected, retrying…';
-        setTimeout(connectWs, 2000);
-      };
-
-      ws.onerror = () => {
-        statusEl.textContent = 'WebSocket error';
-        ws.close();
-      };
-
-      ws.onmessage = (event) => {
-        try {
-          const data = JSON.parse(event.data);
-          if (typeof data.angle === 'number') {
-            angleEl.textContent = `Steering: ${data.angle}°`;
-            const normalizedTilt = clamp(data.angle - 90, -45, 45);
-            setSteeringIndicator(normalizedTilt);
-          }
-          if (typeof data.tilt === 'number' && slider !== document.activeElement) {
-            slider.value = data.tilt;
-            lastTiltSent = parseFloat(data.tilt);
-            setSteeringIndicator(lastTiltSent);
-          }
-          if (typeof data.motorDuty === 'number') {
-            const pct = Math.round(data.motorDuty * 100);
-            motorEl.textContent = `${pct}%`;
-            motorDutyBar.style.height = `${pct}%`;
-          }
-          if (typeof data.gas === 'boolean') {
-            gasButton.classList.toggle('active', data.gas);
-          }
-          if (typeof data.headlight === 'boolean') {
-            headlightOn = data.headlight;
-            headlightButton.classList.toggle('active', headlightOn);
-          }
-        } catch (err) {
-          console.error('Invalid payload', err);
-        }
-      };
-    }
-
-    slider.addEventListener('input', () => {
-      lastTiltSent = parseFloat(slider.value);
-      setSteeringIndicator(lastTiltSent);
-      sendCommand(slider.value);
-    });
-
-    const engageGas = () => {
-      if (!gasHeld) {
-        gasHeld = true;
-        gasButton.classList.add('active');
-        sendCommand('gas_on');
-      }
-    };
-
-    const releaseGas = () => {
-      if (gasHeld) {
-        gasHeld = false;
-        gasButton.classList.remove('active');
-        sendCommand('gas_off');
-      }
-    };
-
-    gasButton.addEventListener('mousedown', engageGas);
-    gasButton.addEventListener('touchstart', (evt) => {
-      evt.preventDefault();
-      engageGas();
-    }, { passive: false });
-
-    const releaseEvents = ['mouseup', 'mouseleave', 'touchend', 'touchcancel', 'pointerup', 'pointercancel'];
-    releaseEvents.forEach((eventName) => {
-      window.addEventListener(eventName, releaseGas);
-    });
-
-    window.addEventListener('blur', releaseGas);
-
-    handbrakeButton.addEventListener('click', () => {
-      releaseGas();
-      sendCommand('handbrake');
-    });
-
-    gyroButton.addEventListener('click', handleZeroButton);
-
-    headlightButton.addEventListener('click', () => {
-      headlightOn = !headlightOn;
-      headlightButton.classList.toggle('active', headlightOn);
-      sendCommand(headlightOn ? 'headlight_on' : 'headlight_off');
-    });
-
-    connectWs();
-  </script>
-</body>
-</html>
-)HTMLDOC";
+// Generated by scripts/build_web_ui.py from web/index.html - do not edit.
+// Source 19684 bytes, minified + gzipped 4705 bytes.
+
+#include <Arduino.h>
+
+static const char WEB_UI_ETAG[] = "\"d4c5f823b4d5db64\"";
+static const size_t WEB_UI_GZ_LEN = 4705;
+static const uint8_t WEB_UI_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x3b,
+  0xcb, 0x72, 0xdb, 0x48, 0x92, 0x77, 0x7d, 0x45, 0x99, 0x6e, 0x37, 0x81,
+  0x6e, 0x12, 0x22, 0x29, 0x5a, 0x0f, 0x52, 0x54, 0xaf, 0x6d, 0xc9, 0x6e,
+  0x4f, 0xf8, 0x15, 0x96, 0x7a, 0xbd, 0xbd, 0x1b, 0x1b, 0x76, 0x11, 0x28,
+  0x92, 0x18, 0x83, 0x00, 0x16, 0x00, 0x45, 0xa9, 0xd9, 0x8c, 0xe8, 0xaf,
+  0x98, 0xd3, 0xee, 0x75, 0xce, 0x73, 0xdc, 0xf3, 0x7c, 0x8a, 0xbf, 0x64,
+  0x33, 0xb3, 0x0a, 0x85, 0xc2, 0x43, 0x94, 0x26, 0x76, 0xf7, 0xd0, 0x6a,
+  0xa0, 0x2a, 0x33, 0x2b, 0xdf, 0x8f, 0x02, 0x7d, 0xfa, 0xe8, 0xfc, 0xfd,
+  0x8b, 0xab, 0x5f, 0x3f, 0x5c, 0xb0, 0x45, 0xb6, 0x0c, 0xce, 0x4e, 0xf1,
+  0x2f, 0x0b, 0x78, 0x38, 0x9f, 0xb4, 0x44, 0xd8, 0x82, 0x77, 0xc1, 0xbd,
+  0xb3, 0xd3, 0xa5, 0xc8, 0x38, 0x73, 0x17, 0x3c, 0x49, 0x45, 0x36, 0x69,
+  0xad, 0xb2, 0x59, 0xf7, 0xb8, 0xa5, 0x56, 0x43, 0xbe, 0x14, 0x93, 0xd6,
+  0xb5, 0x2f, 0xd6, 0x71, 0x94, 0x64, 0x2d, 0xe6, 0x46, 0x61, 0x26, 0x42,
+  0x80, 0x5a, 0xfb, 0x5e, 0xb6, 0x98, 0x78, 0xe2, 0xda, 0x77, 0x45, 0x97,
+  0x5e, 0x3a, 0xcc, 0x0f, 0xfd, 0xcc, 0xe7, 0x41, 0x37, 0x75, 0x79, 0x20,
+  0x26, 0xfd, 0x0e, 0xcb, 0xf1, 0xba, 0x33, 0x3f, 0x9b, 0xb8, 0xd1, 0xb5,
+  0x48, 0x80, 0x6e, 0xe6, 0x67, 0x81, 0x38, 0xfb, 0xf8, 0x82, 0xbd, 0xe0,
+  0x09, 0x7b, 0x01, 0xf4, 0x92, 0x28, 0x38, 0xdd, 0x97, 0xab, 0xec, 0x34,
+  0xcd, 0x6e, 0xe1, 0xff, 0xa3, 0x24, 0x8a, 0xb2, 0x8d, 0x1b, 0x05, 0x51,
+  0x02, 0xd4, 0x16, 0x62, 0x29, 0x46, 0x1e, 0x4f, 0xbe, 0x8e, 0xbb, 0x5d,
+  0x97, 0x27, 0x5e, 0x77, 0x3a, 0x1f, 0x25, 0xf3, 0x29, 0xb7, 0xfa, 0x87,
+  0x9d, 0xc1, 0xb0, 0x73, 0x70, 0xd2, 0xe9, 0x39, 0xc7, 0xb6, 0xde, 0x8c,
+  0x12, 0x4f, 0x24, 0x12, 0x60, 0xf0, 0xf4, 0x69, 0x27, 0xff, 0xaf, 0xe7,
+  0xf4, 0x08, 0x88, 0xbb, 0x2e, 0x48, 0x30, 0x7a, 0x3c, 0x9c, 0xb9, 0x07,
+  0xb3, 0x23, 0xbd, 0xd0, 0x4d, 0x81, 0x91, 0x70, 0x3e, 0x7a, 0xdc, 0xeb,
+  0x4d, 0x5d, 0x6f, 0x08, 0xeb, 0x6b, 0x9e, 0x84, 0x3e, 0xae, 0xcc, 0x66,
+  0xd3, 0xa3, 0xa1, 0xb7, 0xfd, 0x61, 0x33, 0x8d, 0x6e, 0xba, 0xa9, 0xff,
+  0x1b, 0x2e, 0xca, 0x53, 0xe0, 0xb0, 0x9b, 0xed, 0x34, 0xf2, 0x6e, 0x37,
+  0x4b, 0x9e, 0xcc, 0xfd, 0x70, 0xd4, 0x1b, 0xcf, 0x40, 0xa2, 0xee, 0x8c,
+  0x2f, 0xfd, 0xe0, 0x76, 0xd4, 0xbe, 0x7c, 0xc9, 0x3e, 0x24, 0x11, 0x3b,
+  0xf7, 0xd3, 0x38, 0xe0, 0xb7, 0xed, 0x4e, 0xfb, 0x35, 0xa8, 0x2f, 0x69,
+  0x77, 0x9e, 0x25, 0xa0, 0xa7, 0x4e, 0xca, 0xc3, 0xb4, 0x9b, 0x8a, 0xc4,
+  0x9f, 0x8d, 0xa7, 0xdc, 0xfd, 0x3a, 0x4f, 0xa2, 0x55, 0xe8, 0x01, 0x03,
+  0x47, 0xfd, 0xe1, 0xe0, 0x78, 0x4c, 0xd2, 0xc3, 0xe1, 0x87, 0xb3, 0x93,
+  0xd9, 0x6c, 0xbc, 0xf4, 0xc3, 0xee, 0x42, 0xf8, 0xf3, 0x45, 0x36, 0xea,
+  0xf7, 0x7a, 0xd7, 0x8b, 0xb1, 0x27, 0x69, 0x8e, 0x66, 0x81, 0xb8, 0x19,
+  0xf3, 0xc0, 0x9f, 0x87, 0x5d, 0x3f, 0x13, 0xcb, 0x74, 0x04, 0x72, 0x88,
+  0xcc, 0x5d, 0x8c, 0xff, 0xbc, 0x4a, 0x33, 0x7f, 0x76, 0xdb, 0x55, 0x26,
+  0x1b, 0xa1, 0x90, 0x22, 0x19, 0xc7, 0xdc, 0xf3, 0x50, 0x00, 0x37, 0xe0,
+  0xcb, 0x18, 0x34, 0x18, 0xdf, 0x74, 0x86, 0xd7, 0xeb, 0xce, 0xc1, 0x20,
+  0xbe, 0xb1, 0xb7, 0xff, 0xb4, 0x14, 0x9e, 0xcf, 0x99, 0x15, 0x25, 0x3e,
+  0x40, 0xf3, 0xcc, 0x8f, 0xc2, 0x11, 0xb8, 0x8b, 0x07, 0x16, 0x8d, 0x85,
+  0xbd, 0x21, 0x49, 0x73, 0x02, 0xbd, 0xed, 0x76, 0xc9, 0xfd, 0x70, 0x43,
+  0xc6, 0x1f, 0x01, 0x7f, 0x56, 0x1f, 0x38, 0x03, 0x72, 0xf0, 0xf7, 0x89,
+  0x4d, 0x12, 0x79, 0x49, 0x14, 0x83, 0xed, 0x03, 0x38, 0x77, 0x34, 0x0d,
+  0x56, 0x09, 0x1d, 0x07, 0x5b, 0xd2, 0x42, 0xfd, 0xf8, 0x86, 0xa5, 0x51,
+  0xe0, 0x7b, 0xec, 0x9a, 0x27, 0x56, 0xc9, 0x7a, 0x39, 0x4c, 0x37, 0xe1,
+  0x9e, 0xbf, 0x4a, 0x47, 0x83, 0x61, 0x7c, 0x63, 0xea, 0x88, 0x8c, 0x7b,
+  0xd0, 0x39, 0xea, 0xf4, 0x8f, 0xc1, 0xae, 0x87, 0x4f, 0x11, 0x1e, 0x4c,
+  0xb3, 0xe0, 0x5e, 0xb4, 0x1e, 0xf5, 0xd8, 0x00, 0xd8, 0x60, 0x87, 0xf8,
+  0x47, 0x7a, 0x41, 0x07, 0xfc, 0xe4, 0x00, 0x00, 0x8f, 0x00, 0xb0, 0x2c,
+  0x3f, 0x42, 0x4a, 0xf9, 0x89, 0xb3, 0x92, 0x52, 0xf1, 0x4f, 0xd7, 0xf3,
+  0x13, 0xe1, 0x92, 0x1e, 0xc0, 0x1e, 0xab, 0x65, 0x38, 0x9e, 0xf3, 0x58,
+  0xb2, 0xd3, 0xa0, 0xf3, 0xfb, 0xf4, 0x67, 0xe8, 0x0b, 0x8d, 0xb8, 0x1e,
+  0x97, 0x2c, 0x5a, 0x16, 0xb9, 0x97, 0xab, 0x29, 0x8c, 0x42, 0xa1, 0xb9,
+  0x46, 0x7e, 0x89, 0x05, 0xd4, 0xe4, 0x76, 0xeb, 0xb8, 0x32, 0x7e, 0xba,
+  0xf3, 0xc4, 0xf7, 0x36, 0x25, 0xee, 0x77, 0xf1, 0x49, 0xa2, 0x8d, 0xfa,
+  0xac, 0xcf, 0x7a, 0x48, 0x02, 0xe5, 0xda, 0xc8, 0xa5, 0x7f, 0x44, 0x03,
+  0x5b, 0x67, 0xe9, 0x7b, 0x5d, 0x13, 0xbd, 0xc7, 0x50, 0xf7, 0xc8, 0x62,
+  0xb3, 0xf3, 0x6d, 0x9d, 0x6c, 0x91, 0x44, 0x19, 0x44, 0x7a, 0x0d, 0xed,
+  0x00, 0x25, 0xdb, 0x2e, 0xfa, 0x1b, 0x8a, 0x1f, 0x08, 0x32, 0x91, 0x7b,
+  0xa8, 0x33, 0x48, 0xc4, 0xb2, 0x73, 0x00, 0x36, 0xea, 0x3b, 0xc7, 0xf0,
+  0x68, 0x8f, 0xf3, 0x58, 0xdb, 0x3e, 0x4e, 0x41, 0xc7, 0xab, 0xd4, 0xc0,
+  0xe9, 0x39, 0x27, 0x00, 0xa2, 0x62, 0x47, 0xba, 0x95, 0x0a, 0x63, 0x7b,
+  0xeb, 0x4c, 0x57, 0x59, 0x16, 0x85, 0xdd, 0x24, 0x5a, 0x6f, 0xea, 0x62,
+  0xae, 0x13, 0x10, 0x0b, 0xff, 0x48, 0xf5, 0x42, 0x38, 0x6c, 0x25, 0xbc,
+  0x41, 0xbd, 0x8f, 0xb4, 0x73, 0x53, 0x20, 0x08, 0x93, 0x8e, 0x59, 0x32,
+  0xdc, 0xc9, 0xc9, 0x89, 0x5e, 0x33, 0x7c, 0x3c, 0x4b, 0x20, 0xda, 0x63,
+  0x9e, 0x80, 0x22, 0xf2, 0xd0, 0xee, 0x0d, 0xfb, 0xbd, 0x41, 0xdf, 0xf4,
+  0x6b, 0xc9, 0xb1, 0x4c, 0x48, 0xf6, 0xd8, 0x5d, 0x25, 0x29, 0xc0, 0xc5,
+  0x91, 0x4f, 0x91, 0x4b, 0x14, 0x7c, 0xb2, 0x04, 0x3d, 0xce, 0xa2, 0x64,
+  0xc9, 0x7a, 0xce, 0x20, 0x65, 0x82, 0xa7, 0xa2, 0x53, 0x44, 0x80, 0xb9,
+  0xa8, 0x69, 0x17, 0x8b, 0x4a, 0xae, 0xd1, 0x02, 0x13, 0xf2, 0x46, 0x93,
+  0x92, 0x44, 0x03, 0x9e, 0x89, 0x5f, 0xad, 0x6e, 0x5f, 0xc6, 0xa9, 0x11,
+  0x53, 0x7d, 0x0c, 0xa7, 0x81, 0x8e, 0xa9, 0xa3, 0x93, 0x4e, 0xff, 0x04,
+  0x12, 0xeb, 0xf0, 0x08, 0xe2, 0x6a, 0xf0, 0xd4, 0xce, 0x89, 0x72, 0x70,
+  0x95, 0x6b, 0x38, 0x97, 0xde, 0x1c, 0xf9, 0xb6, 0xb9, 0x43, 0x42, 0x95,
+  0x72, 0x35, 0x2e, 0x18, 0x85, 0x4f, 0x03, 0xe1, 0x6d, 0xa2, 0x98, 0xbb,
+  0x7e, 0x76, 0x0b, 0xd6, 0x1c, 0xe6, 0x4a, 0x08, 0xa3, 0xac, 0xcb, 0x83,
+  0x20, 0x5a, 0x0b, 0xcf, 0xf4, 0x22, 0x48, 0x19, 0x1b, 0xd3, 0xc1, 0x55,
+  0x92, 0xcb, 0xc4, 0x0d, 0x82, 0xc3, 0x7a, 0xbe, 0x72, 0xaf, 0x43, 0x52,
+  0x01, 0x32, 0x6d, 0xed, 0x90, 0xb5, 0x03, 0x91, 0x01, 0x5c, 0x37, 0x45,
+  0x8e, 0x30, 0xe9, 0x41, 0x11, 0x81, 0x55, 0xa2, 0x5f, 0x68, 0x6e, 0x15,
+  0xc7, 0x22, 0x71, 0x41, 0xb5, 0xca, 0xb2, 0x0d, 0xb5, 0xe7, 0xc8, 0x36,
+  0xce, 0x92, 0xf2, 0xa6, 0x9b, 0x87, 0x06, 0x5b, 0xaf, 0x12, 0xc6, 0x39,
+  0xf3, 0xae, 0x9f, 0xb8, 0x9a, 0x5c, 0x9e, 0x58, 0x08, 0x3a, 0x4f, 0x2c,
+  0xf4, 0x52, 0xf6, 0xcf, 0xa7, 0xbd, 0x27, 0x77, 0x17, 0x8f, 0x9d, 0xda,
+  0x1a, 0xd7, 0xb4, 0xa3, 0x6b, 0x41, 0xee, 0xef, 0x03, 0xed, 0xef, 0x0d,
+  0x3a, 0x00, 0x37, 0xd1, 0x55, 0x0d, 0x4a, 0x1a, 0x51, 0x5b, 0x4b, 0x46,
+  0x0f, 0x7b, 0x90, 0x89, 0xe6, 0x3c, 0xed, 0x4e, 0xb3, 0xd0, 0x74, 0x97,
+  0xc7, 0x83, 0xfe, 0xc9, 0xe1, 0xec, 0x00, 0x62, 0x37, 0xe1, 0x5f, 0x45,
+  0x6d, 0x77, 0x36, 0x1c, 0x1e, 0x1c, 0x1c, 0x56, 0x14, 0x91, 0xfb, 0x60,
+  0x79, 0x35, 0xf7, 0xc5, 0xc2, 0xb7, 0x8e, 0xb7, 0xa9, 0xd4, 0xb5, 0x43,
+  0x6e, 0x54, 0xa9, 0x38, 0xbd, 0xa6, 0x20, 0x6e, 0x2a, 0x54, 0x55, 0xdf,
+  0x56, 0x1d, 0x8a, 0xdd, 0x54, 0x69, 0x31, 0x8b, 0x0d, 0x8e, 0x1f, 0x58,
+  0x69, 0x64, 0x46, 0xde, 0x3a, 0x69, 0x26, 0xa0, 0x47, 0x08, 0xe7, 0xdd,
+  0x6b, 0x1e, 0xac, 0xca, 0x2e, 0x8a, 0xa9, 0xb1, 0xae, 0x47, 0x8d, 0xb0,
+  0x5e, 0x08, 0x11, 0xdc, 0xed, 0x17, 0x71, 0xa4, 0xd2, 0x49, 0x22, 0x20,
+  0xec, 0x41, 0x39, 0xe5, 0x36, 0x04, 0xb3, 0xd3, 0x61, 0x83, 0xf3, 0xd4,
+  0xb4, 0xd2, 0xd4, 0x6a, 0x1d, 0xda, 0x06, 0x1f, 0x3c, 0xc1, 0x9c, 0xab,
+  0x8f, 0xe3, 0x53, 0xc0, 0x5b, 0x65, 0x02, 0x82, 0x6b, 0x96, 0x11, 0xc9,
+  0x2c, 0x8a, 0xe9, 0xff, 0x92, 0xd5, 0x5e, 0xce, 0x66, 0xee, 0x56, 0x5d,
+  0x02, 0xec, 0x0f, 0x1a, 0x93, 0x69, 0xce, 0xa0, 0x12, 0x6c, 0x17, 0xcc,
+  0x14, 0xc2, 0x2f, 0x5a, 0x52, 0xf1, 0x52, 0x40, 0x79, 0x17, 0xa8, 0x63,
+  0xb9, 0x0b, 0xa5, 0x1b, 0x8b, 0x0b, 0x70, 0xc3, 0x88, 0xb3, 0x7a, 0x7a,
+  0xb4, 0xba, 0xb0, 0xd1, 0xc1, 0x3f, 0x36, 0x83, 0x80, 0xc6, 0x15, 0x95,
+  0xd5, 0xc2, 0x79, 0x20, 0x3a, 0x3d, 0x4f, 0xcc, 0x6d, 0x7b, 0xfb, 0x38,
+  0x83, 0xbe, 0xe7, 0x12, 0xce, 0x80, 0x1c, 0xab, 0x4b, 0xfe, 0x93, 0x31,
+  0x87, 0x54, 0xc1, 0x81, 0x92, 0x2b, 0x64, 0x61, 0xd7, 0x06, 0xb9, 0xab,
+  0x8e, 0x54, 0x9a, 0x9e, 0xb2, 0x9a, 0xfb, 0x10, 0x51, 0xd1, 0x2a, 0x0b,
+  0xfc, 0x50, 0x92, 0x33, 0x4f, 0x1d, 0x8d, 0xc0, 0x29, 0xa6, 0x5f, 0x7d,
+  0x70, 0x16, 0x7a, 0xef, 0x66, 0x8b, 0xd5, 0x72, 0xba, 0xa9, 0x32, 0x20,
+  0x79, 0x1b, 0x1c, 0x16, 0xce, 0x41, 0xcf, 0x0d, 0x66, 0xbf, 0xab, 0x4c,
+  0x95, 0xca, 0xc4, 0xe1, 0xdd, 0x55, 0x62, 0xf8, 0xd4, 0x7e, 0x50, 0x9a,
+  0x78, 0x6a, 0x57, 0xc4, 0x58, 0x46, 0xbf, 0x01, 0x23, 0xe1, 0x5c, 0x28,
+  0x11, 0xfe, 0x2f, 0x58, 0xd6, 0xad, 0x55, 0x29, 0x09, 0xb0, 0xb8, 0xde,
+  0x4b, 0xa8, 0x6e, 0x03, 0xa2, 0x16, 0xba, 0xa5, 0xc7, 0xf3, 0xdb, 0x24,
+  0xba, 0xac, 0x77, 0x1d, 0xc7, 0x45, 0xd7, 0xd1, 0x98, 0xfc, 0x4b, 0xfd,
+  0xbb, 0x33, 0x04, 0x68, 0xe8, 0x9e, 0xa2, 0x0c, 0xc6, 0x1b, 0x18, 0xb3,
+  0xb4, 0x87, 0x0c, 0x8d, 0x10, 0x95, 0x7d, 0x54, 0x53, 0x52, 0x32, 0x63,
+  0xd4, 0x1b, 0x1e, 0xf1, 0xfe, 0x18, 0x0b, 0xf9, 0x0c, 0x6a, 0xe3, 0x68,
+  0xe1, 0x7b, 0x9e, 0x08, 0x1f, 0x14, 0xa1, 0x83, 0xa2, 0x8f, 0x62, 0x7c,
+  0x95, 0x45, 0xf5, 0x6c, 0xb0, 0x7d, 0x4c, 0x1c, 0x9e, 0xaf, 0xb2, 0xdb,
+  0xe7, 0xbc, 0xe4, 0xc4, 0x79, 0x78, 0x96, 0x34, 0x0c, 0x39, 0xdd, 0x3b,
+  0xea, 0xf5, 0xc6, 0xf5, 0x30, 0x57, 0x61, 0x07, 0x99, 0xc9, 0x03, 0x5a,
+  0xff, 0xff, 0x95, 0xb6, 0x5e, 0xfe, 0x1b, 0x1b, 0x73, 0x9c, 0x4c, 0x13,
+  0xee, 0x67, 0x36, 0x8b, 0x12, 0x66, 0x2d, 0xf9, 0x8d, 0x9c, 0x63, 0x47,
+  0x27, 0xa8, 0x79, 0x7b, 0xd3, 0x58, 0x5d, 0x0f, 0x0d, 0x0b, 0xd1, 0x73,
+  0xd5, 0x09, 0x9a, 0xcc, 0x4a, 0x4d, 0xa2, 0x99, 0x79, 0x1f, 0x9c, 0xa2,
+  0x6b, 0x39, 0xd4, 0xc8, 0x87, 0x8a, 0xdb, 0x63, 0xc3, 0x4b, 0x10, 0xb1,
+  0xbe, 0x2c, 0xd5, 0xaf, 0xd6, 0xb1, 0x0c, 0x51, 0xba, 0xa5, 0xb3, 0x6a,
+  0x69, 0x0f, 0xbd, 0x5c, 0x8e, 0x16, 0xb9, 0xc6, 0x0a, 0xbd, 0x1c, 0x4a,
+  0xbd, 0xd0, 0x10, 0x53, 0xf6, 0x4b, 0xc2, 0xc8, 0xbb, 0x65, 0x39, 0x47,
+  0xd4, 0x4d, 0xb0, 0x3d, 0xdd, 0x97, 0xc3, 0x3d, 0x3b, 0xdd, 0x97, 0xf7,
+  0x0e, 0x38, 0x4e, 0x9e, 0x9d, 0x22, 0x3d, 0x79, 0x13, 0x21, 0x92, 0xb3,
+  0x53, 0xcf, 0xbf, 0x86, 0x97, 0x7e, 0xe5, 0x7e, 0x20, 0x10, 0x09, 0x20,
+  0xf5, 0xcf, 0x4e, 0x63, 0xe6, 0x7b, 0x93, 0x96, 0x6c, 0xfb, 0x5b, 0x67,
+  0xb0, 0x1b, 0x62, 0xf4, 0x86, 0xf3, 0x6f, 0x7f, 0xfc, 0xf5, 0x74, 0x3f,
+  0x3e, 0x3b, 0xdd, 0x27, 0x7c, 0xf8, 0xc3, 0xa0, 0xea, 0xa6, 0xe9, 0xa4,
+  0x55, 0xf4, 0xfc, 0x2d, 0x38, 0x90, 0x5e, 0x88, 0x04, 0xc6, 0xf1, 0x73,
+  0x7a, 0x6d, 0xb1, 0xec, 0x36, 0x16, 0x39, 0x64, 0xeb, 0xec, 0x5f, 0x05,
+  0x4c, 0xec, 0xaf, 0x60, 0xfb, 0x74, 0x5f, 0x2e, 0x95, 0xf0, 0x90, 0xcf,
+  0x00, 0xf5, 0xdc, 0x8c, 0xfc, 0x73, 0xbe, 0x5d, 0x20, 0x4b, 0x96, 0x62,
+  0x7d, 0xea, 0xa5, 0x62, 0xfe, 0x8a, 0xc7, 0xec, 0xdb, 0x1f, 0xff, 0xa9,
+  0x8f, 0xfb, 0xf6, 0xc7, 0x7f, 0xb1, 0x2c, 0x62, 0x73, 0x30, 0x49, 0xc6,
+  0xc0, 0x89, 0xc0, 0x45, 0x19, 0xe6, 0xab, 0x34, 0x65, 0x30, 0x41, 0x32,
+  0x17, 0x94, 0x09, 0x4d, 0x50, 0x26, 0x58, 0xb6, 0x10, 0x0c, 0xba, 0x62,
+  0x2c, 0x6c, 0x8c, 0xdc, 0x87, 0xe5, 0x21, 0xe7, 0x48, 0x1d, 0x18, 0xba,
+  0xcc, 0xd5, 0x60, 0xce, 0x89, 0xad, 0xca, 0x0e, 0x36, 0x1b, 0x4c, 0xfb,
+  0x99, 0x7c, 0x07, 0x18, 0x95, 0x17, 0x35, 0x1c, 0xa6, 0xc7, 0x02, 0x0a,
+  0xde, 0xca, 0x74, 0xca, 0x1e, 0xdd, 0x52, 0x76, 0x92, 0x6b, 0x9f, 0x68,
+  0xa9, 0x19, 0x9c, 0xfc, 0xba, 0x0c, 0xfe, 0x2c, 0x91, 0xe6, 0x92, 0x9a,
+  0xab, 0x99, 0xb4, 0xdc, 0x0f, 0x49, 0x54, 0x2a, 0xbd, 0xea, 0x9a, 0xa5,
+  0x75, 0x76, 0xa9, 0x20, 0x46, 0xec, 0xa4, 0xf7, 0xf7, 0xbf, 0x29, 0x0a,
+  0x7e, 0x18, 0xaf, 0x32, 0x65, 0x2e, 0xaa, 0x26, 0x2d, 0x06, 0x49, 0x79,
+  0xd2, 0xea, 0x0e, 0x9f, 0xc2, 0x13, 0xbf, 0x99, 0xb4, 0xf0, 0x01, 0x88,
+  0xc7, 0x93, 0x16, 0x54, 0xd6, 0x16, 0x23, 0xf2, 0xf0, 0x2c, 0x4f, 0x28,
+  0x2a, 0x12, 0x70, 0x16, 0x9f, 0xd1, 0x23, 0x26, 0x0e, 0x5c, 0x67, 0x56,
+  0x31, 0xe4, 0xa3, 0x0d, 0x89, 0x43, 0x65, 0x0c, 0xa5, 0xc6, 0x06, 0x39,
+  0x94, 0xe6, 0x8b, 0x21, 0xfa, 0x0e, 0xa5, 0x53, 0xd2, 0xac, 0x2b, 0xbc,
+  0xc8, 0xa5, 0xad, 0xb3, 0xb7, 0x98, 0x73, 0xd8, 0x07, 0x98, 0x8e, 0x92,
+  0xfa, 0x39, 0x46, 0x42, 0x52, 0x14, 0x50, 0x1e, 0x33, 0xb7, 0x57, 0x74,
+  0x1d, 0x1b, 0x00, 0xb9, 0x4a, 0x7b, 0x4f, 0x1e, 0x28, 0x4e, 0x65, 0xc2,
+  0xbf, 0x43, 0xa6, 0xd2, 0x04, 0x57, 0x96, 0xab, 0x3c, 0x91, 0x41, 0x9c,
+  0xa8, 0xf7, 0xfa, 0x89, 0xd5, 0x79, 0xaa, 0x88, 0xf0, 0xfc, 0x28, 0x33,
+  0x83, 0x33, 0x35, 0x5e, 0x48, 0x73, 0xc2, 0x4b, 0x73, 0x04, 0xbf, 0xe2,
+  0x69, 0x2d, 0xf0, 0x1b, 0xc9, 0xe9, 0x89, 0x44, 0x12, 0x5c, 0x80, 0x07,
+  0xd0, 0x52, 0x33, 0xd9, 0xe7, 0xb8, 0x55, 0x4b, 0x0a, 0x67, 0x3f, 0x47,
+  0x81, 0xc7, 0xe0, 0x48, 0xf4, 0x1a, 0x0c, 0x76, 0x48, 0x74, 0x10, 0xe2,
+  0x0e, 0xc3, 0xe4, 0x40, 0x28, 0xb8, 0xe1, 0x82, 0xdf, 0xc6, 0x68, 0xdb,
+  0x66, 0x97, 0x52, 0x7f, 0x29, 0x8f, 0xb2, 0xd3, 0xd4, 0x4d, 0xfc, 0x38,
+  0x3b, 0x83, 0x80, 0x4f, 0x33, 0x26, 0x3b, 0x3f, 0x36, 0x61, 0x5e, 0xe4,
+  0xae, 0x96, 0x90, 0x30, 0x9c, 0xb9, 0xc8, 0x2e, 0x02, 0x81, 0x8f, 0xcf,
+  0x6f, 0x5f, 0x7b, 0x56, 0xbb, 0x70, 0xeb, 0xb6, 0x3d, 0xde, 0x53, 0x58,
+  0x94, 0xa1, 0x2e, 0x82, 0x5d, 0x78, 0x12, 0xa6, 0xc0, 0xa1, 0x00, 0xdc,
+  0x8d, 0x62, 0xc6, 0xa8, 0x79, 0x98, 0x91, 0x23, 0x76, 0x9f, 0x68, 0x00,
+  0x16, 0xf8, 0xda, 0x90, 0xbb, 0x70, 0x35, 0x50, 0x81, 0x57, 0xb1, 0xd7,
+  0x2e, 0xec, 0x0a, 0x68, 0x41, 0x83, 0x42, 0x64, 0xb7, 0xd0, 0x66, 0x14,
+  0x55, 0x10, 0x55, 0xf0, 0xdd, 0x8f, 0x2d, 0xe1, 0x0c, 0x91, 0x75, 0xed,
+  0xda, 0x29, 0xb3, 0x86, 0x2a, 0x63, 0x5e, 0x3e, 0xc0, 0xba, 0x05, 0x9c,
+  0xa1, 0xb0, 0x72, 0xe5, 0xdb, 0xa9, 0xb0, 0x32, 0x28, 0xd2, 0x80, 0xee,
+  0x8e, 0xad, 0x53, 0xf9, 0x7f, 0xb0, 0xc6, 0xcf, 0x02, 0xfc, 0x7e, 0xc2,
+  0x66, 0x3c, 0x80, 0x56, 0x4e, 0x2e, 0xc2, 0x91, 0x17, 0x21, 0xdd, 0xff,
+  0xd4, 0x37, 0x3e, 0x8a, 0xff, 0x58, 0x89, 0x34, 0x7b, 0x1d, 0xbe, 0x24,
+  0xb2, 0x65, 0x00, 0x08, 0xce, 0xec, 0x0a, 0xdd, 0x18, 0x0b, 0xe2, 0x84,
+  0xc5, 0xf8, 0x1d, 0xe3, 0x65, 0x10, 0xf1, 0xcc, 0x92, 0xee, 0xef, 0x50,
+  0x22, 0xb7, 0x0b, 0xe0, 0x8f, 0x7c, 0x9d, 0x7b, 0x5b, 0xaf, 0x38, 0x03,
+  0x0b, 0xf1, 0xfb, 0xd9, 0x2c, 0x15, 0x59, 0xb1, 0xae, 0x05, 0x79, 0x1f,
+  0x16, 0x67, 0x4a, 0x75, 0x5c, 0xbd, 0x7e, 0x73, 0xf5, 0xf9, 0xf2, 0xe2,
+  0xdd, 0xf9, 0xe7, 0xd7, 0xef, 0xae, 0x2e, 0x3e, 0xfe, 0xf3, 0xb3, 0x37,
+  0x9f, 0xdf, 0x5e, 0x02, 0xd0, 0xa0, 0x97, 0x43, 0xbc, 0x7d, 0xf6, 0x2f,
+  0x9f, 0x9f, 0xff, 0xf2, 0xf2, 0xe5, 0xc5, 0xc7, 0x8b, 0xf3, 0xcf, 0xcf,
+  0x7f, 0xbd, 0xba, 0xc0, 0xed, 0xc3, 0xa1, 0xa4, 0x1c, 0x8b, 0x10, 0x2f,
+  0x07, 0x90, 0x6f, 0x58, 0x0d, 0x57, 0x41, 0x50, 0x16, 0xe6, 0x03, 0xbf,
+  0x05, 0x11, 0xbc, 0xd2, 0x9e, 0xc2, 0x41, 0xc3, 0x88, 0xd2, 0x06, 0xb4,
+  0x02, 0x20, 0xe7, 0xa5, 0xbb, 0x10, 0xde, 0xaa, 0xa4, 0x3f, 0xc3, 0xdb,
+  0x3e, 0xf2, 0x65, 0x0c, 0x1b, 0x1b, 0x2a, 0x27, 0x23, 0xd6, 0xeb, 0xa0,
+  0x19, 0x46, 0x12, 0xb0, 0x23, 0x73, 0x0f, 0xad, 0x7a, 0x22, 0x7f, 0x82,
+  0x9a, 0x38, 0x62, 0x7d, 0xd8, 0xcb, 0x46, 0x70, 0x74, 0x82, 0x6d, 0x22,
+  0x8e, 0x8d, 0x4e, 0x18, 0xad, 0x2d, 0x9b, 0x6d, 0xe5, 0xd1, 0x54, 0x56,
+  0x9e, 0x85, 0xfe, 0x92, 0x63, 0x1b, 0x56, 0x37, 0xcc, 0x5b, 0xdc, 0xff,
+  0xe0, 0xa2, 0x90, 0xdd, 0x7e, 0xce, 0x90, 0x1b, 0x60, 0x17, 0xfe, 0x1a,
+  0x19, 0x4d, 0xa1, 0xbf, 0x81, 0x5c, 0x76, 0x09, 0x1c, 0xf2, 0xb9, 0x40,
+  0x4f, 0x7a, 0x9d, 0x89, 0xa5, 0xd5, 0x4e, 0xdc, 0x17, 0x0a, 0xa8, 0x6d,
+  0xb3, 0xdf, 0x7f, 0xdf, 0x7b, 0xcb, 0xb3, 0x85, 0x03, 0x65, 0xdb, 0x8b,
+  0x96, 0x96, 0xed, 0x64, 0xe0, 0x9d, 0x98, 0x0b, 0xac, 0x83, 0x43, 0xdb,
+  0x01, 0x2b, 0xbb, 0xc2, 0x1a, 0x74, 0x58, 0xbf, 0x67, 0xb3, 0x1f, 0xd9,
+  0x39, 0x26, 0x50, 0xe2, 0xb1, 0x04, 0x36, 0xde, 0xab, 0x1c, 0x95, 0x36,
+  0x1c, 0xd5, 0xd1, 0xac, 0x15, 0xf9, 0x49, 0x64, 0x79, 0x3b, 0xf1, 0x1a,
+  0xd4, 0xef, 0x72, 0xac, 0xb4, 0x13, 0x66, 0x61, 0xe2, 0x3c, 0x17, 0xf3,
+  0x44, 0x88, 0xd4, 0x66, 0x93, 0x33, 0xb6, 0xc9, 0x13, 0x21, 0x36, 0x2f,
+  0x0f, 0xc9, 0x63, 0xd4, 0xe5, 0x60, 0x68, 0xf8, 0x33, 0x66, 0x11, 0x96,
+  0x2d, 0x91, 0x1d, 0x6a, 0x93, 0x91, 0xbf, 0x0f, 0x49, 0x04, 0x8a, 0xcf,
+  0x6e, 0xad, 0xb6, 0xba, 0x5c, 0x00, 0x06, 0xbf, 0x7c, 0xb7, 0x31, 0x8e,
+  0x66, 0x3f, 0xb0, 0xc1, 0xd6, 0x13, 0xf3, 0x2f, 0x40, 0x67, 0x5b, 0xb0,
+  0x1c, 0x7a, 0x2f, 0xa2, 0xe5, 0x12, 0xdb, 0x46, 0xe0, 0x34, 0x96, 0xae,
+  0xa4, 0xb8, 0xc4, 0xd3, 0xd6, 0x29, 0xfb, 0xfe, 0x7b, 0x08, 0x47, 0x27,
+  0x01, 0xff, 0xbe, 0x55, 0xfe, 0x34, 0x99, 0xb0, 0x4f, 0x62, 0x7a, 0x19,
+  0xb9, 0x5f, 0x45, 0xe6, 0xbc, 0xff, 0x70, 0xf1, 0xce, 0x06, 0x68, 0x80,
+  0x41, 0x6a, 0x9a, 0x06, 0x9c, 0x52, 0x9c, 0x03, 0x31, 0xb9, 0x12, 0xca,
+  0x83, 0x49, 0x1f, 0xea, 0x88, 0xb2, 0x6f, 0xe3, 0x86, 0xc1, 0xdc, 0x2c,
+  0x58, 0xa5, 0x8b, 0x1c, 0xc9, 0xe0, 0xa9, 0x84, 0x34, 0x91, 0xde, 0x6d,
+  0x83, 0x67, 0x67, 0xab, 0x24, 0x94, 0x3a, 0x7a, 0x04, 0x6c, 0xff, 0xfe,
+  0x7b, 0x85, 0xed, 0x47, 0x0d, 0x6c, 0x9b, 0x48, 0x00, 0x3d, 0x5d, 0xcd,
+  0x66, 0x22, 0x11, 0xde, 0xb3, 0x25, 0xcc, 0xa9, 0x19, 0x3b, 0x6b, 0x08,
+  0xcc, 0x02, 0x47, 0x32, 0x19, 0xeb, 0xe8, 0x33, 0xd8, 0x02, 0x77, 0x7a,
+  0xe9, 0xdf, 0x08, 0xcf, 0x82, 0xd1, 0x79, 0xaf, 0x29, 0x7e, 0x49, 0x8c,
+  0x1c, 0x13, 0xf8, 0xaa, 0xc4, 0x72, 0x71, 0x48, 0x3d, 0xc8, 0x15, 0xda,
+  0xb8, 0x49, 0xe1, 0x45, 0xd4, 0xc8, 0x10, 0xb6, 0x28, 0x9f, 0x75, 0xb0,
+  0x7b, 0xa5, 0x20, 0x25, 0x25, 0x52, 0x7c, 0xe0, 0x47, 0x38, 0x58, 0xe8,
+  0xa8, 0x37, 0x7e, 0x63, 0x11, 0x8c, 0xcc, 0x7f, 0xf5, 0xe2, 0xf3, 0x8e,
+  0x1c, 0xd5, 0x2a, 0xb9, 0x6f, 0x22, 0x73, 0x8b, 0x4e, 0x19, 0x78, 0x29,
+  0xcb, 0x7e, 0x32, 0xde, 0x29, 0x53, 0xb0, 0x11, 0xeb, 0x16, 0x4b, 0x94,
+  0x32, 0xc6, 0x7b, 0x52, 0x3a, 0xc9, 0xa6, 0x65, 0xec, 0xc2, 0x49, 0x10,
+  0x96, 0x44, 0xf8, 0x07, 0xb4, 0x73, 0x35, 0x93, 0x74, 0x4d, 0xea, 0x99,
+  0xdd, 0xa1, 0xdc, 0xa3, 0x57, 0x50, 0x40, 0x43, 0x09, 0x9c, 0x52, 0x8d,
+  0xa0, 0xb4, 0x52, 0x63, 0x9e, 0x8e, 0x9a, 0x94, 0x04, 0xb4, 0xb4, 0xd8,
+  0x31, 0x25, 0x21, 0x99, 0x47, 0xf0, 0xc2, 0xc2, 0x22, 0xe8, 0x1f, 0x20,
+  0x6b, 0xf4, 0x54, 0x10, 0x22, 0xc4, 0x23, 0x65, 0xb7, 0x3c, 0x6f, 0x61,
+  0x10, 0x54, 0xf2, 0x18, 0x80, 0x8d, 0xf7, 0x54, 0xe9, 0x77, 0x70, 0xce,
+  0x7d, 0x21, 0x6f, 0xc9, 0x61, 0x0b, 0x82, 0x13, 0x76, 0xb7, 0x4f, 0xbe,
+  0x28, 0x00, 0x55, 0xba, 0x55, 0x44, 0xcb, 0xc9, 0xbe, 0x0c, 0xb6, 0x2d,
+  0xd2, 0x4c, 0x26, 0x53, 0x77, 0x55, 0xf5, 0xc4, 0xe6, 0xd9, 0xa4, 0xac,
+  0x12, 0x30, 0x00, 0xad, 0x9f, 0x52, 0xa9, 0xaa, 0x25, 0xe1, 0x47, 0x8a,
+  0x9c, 0x94, 0xab, 0xbc, 0x8d, 0x6e, 0x48, 0xd5, 0x54, 0xad, 0x44, 0xe1,
+  0xcb, 0x84, 0x2f, 0x85, 0x65, 0x6a, 0xd6, 0xd4, 0x78, 0x22, 0xa6, 0x3c,
+  0x15, 0x72, 0xc2, 0x00, 0x85, 0xe3, 0xb1, 0x54, 0x3b, 0x94, 0xe6, 0x2b,
+  0x86, 0x9e, 0x10, 0x5f, 0xe3, 0xbd, 0xb2, 0x14, 0x13, 0x44, 0x30, 0x17,
+  0x39, 0x29, 0xb2, 0xea, 0x0a, 0x2a, 0xce, 0xab, 0xfc, 0x6e, 0xea, 0x02,
+  0x66, 0xc9, 0x4a, 0xa0, 0xc7, 0x3d, 0x44, 0x90, 0x42, 0x94, 0x55, 0xec,
+  0xc1, 0xc6, 0x4b, 0x08, 0x56, 0xe8, 0x92, 0x85, 0x08, 0xdf, 0xf0, 0x29,
+  0x75, 0x01, 0xb9, 0x17, 0x69, 0xc0, 0x2c, 0x9a, 0x43, 0xb6, 0x2d, 0x00,
+  0x9b, 0x60, 0xfc, 0xf4, 0x4d, 0x3e, 0xf4, 0xbd, 0x2f, 0x6e, 0x95, 0x2a,
+  0x59, 0x6d, 0xed, 0x43, 0xc5, 0x82, 0x8c, 0x4e, 0x54, 0x7e, 0x72, 0x8c,
+  0xeb, 0x27, 0xcc, 0xc0, 0x38, 0x22, 0x44, 0x33, 0x56, 0x02, 0x32, 0x61,
+  0x1c, 0x4a, 0xfa, 0x94, 0x4b, 0xda, 0xe1, 0x6a, 0x39, 0xc5, 0x26, 0x1d,
+  0x08, 0xab, 0x40, 0x23, 0x57, 0xe6, 0xd3, 0xd4, 0xba, 0x07, 0xdf, 0x26,
+  0x02, 0x27, 0x3d, 0x54, 0x05, 0xf2, 0x54, 0x3e, 0xd5, 0x64, 0xe9, 0x81,
+  0x07, 0x19, 0x28, 0x26, 0x6d, 0x05, 0xad, 0x80, 0xfc, 0x30, 0x14, 0xc9,
+  0x27, 0xbc, 0x38, 0x82, 0x8c, 0x6b, 0xae, 0xfd, 0x4c, 0x51, 0x60, 0xe6,
+  0xb5, 0x68, 0x09, 0x93, 0xb9, 0xa0, 0x96, 0xec, 0x63, 0x54, 0xa8, 0x51,
+  0x5c, 0xe3, 0x5d, 0x6d, 0xa1, 0xcb, 0x66, 0x85, 0x83, 0xb6, 0x0b, 0x4d,
+  0x12, 0x8a, 0x33, 0xc5, 0x5f, 0xae, 0xdc, 0x21, 0x4b, 0x01, 0x51, 0x51,
+  0x87, 0xdc, 0x98, 0x73, 0x28, 0x9b, 0xbb, 0x71, 0x09, 0xa4, 0x11, 0xf9,
+  0xe1, 0xe7, 0xaa, 0xc5, 0x9e, 0xa1, 0x05, 0x1c, 0x32, 0x82, 0xaa, 0x27,
+  0x55, 0x55, 0xf0, 0xc8, 0xe8, 0x92, 0xab, 0x35, 0x2b, 0x29, 0xba, 0xda,
+  0x26, 0x8d, 0x2a, 0x5a, 0xb2, 0xf8, 0x18, 0x1d, 0x70, 0x8e, 0xa6, 0x5d,
+  0x5f, 0x56, 0x34, 0x99, 0xc5, 0x35, 0xcd, 0x6e, 0xa5, 0x45, 0xee, 0xb0,
+  0xee, 0xf0, 0x69, 0x87, 0xe1, 0x95, 0x3e, 0x31, 0xa6, 0x5d, 0x84, 0xd0,
+  0xbb, 0xa5, 0x9e, 0xdc, 0x66, 0xa7, 0x0c, 0x6f, 0xf5, 0x35, 0xbf, 0x66,
+  0x5b, 0xae, 0x1a, 0x04, 0x5d, 0x5b, 0xfb, 0x76, 0x51, 0x1e, 0x55, 0x43,
+  0x2f, 0x1b, 0x88, 0xa6, 0x3e, 0x4c, 0x36, 0x1d, 0xe3, 0x3d, 0xdd, 0x88,
+  0xe4, 0x0b, 0x5b, 0x63, 0x94, 0x4d, 0xb2, 0x57, 0x34, 0xcd, 0x40, 0xd3,
+  0xb0, 0xac, 0x44, 0x67, 0xa3, 0x36, 0x95, 0xaf, 0x72, 0xcf, 0xbb, 0x40,
+  0x8d, 0xbd, 0xf1, 0xa1, 0x61, 0x03, 0xb7, 0xb5, 0xda, 0xf2, 0xc7, 0x4e,
+  0x86, 0xf3, 0x43, 0x37, 0x56, 0xb3, 0x1a, 0x1c, 0x5e, 0x9e, 0x64, 0x64,
+  0xa6, 0x32, 0x07, 0xaf, 0x4a, 0xcd, 0x68, 0x23, 0x7b, 0x8c, 0x5a, 0x1a,
+  0x39, 0xf7, 0x57, 0x2f, 0x05, 0x79, 0x78, 0x0b, 0x3a, 0x58, 0xd2, 0x55,
+  0x40, 0x22, 0xe4, 0x6d, 0x2a, 0x5d, 0x02, 0xe6, 0x9d, 0xa4, 0xbc, 0x05,
+  0x74, 0xda, 0x86, 0xdc, 0x22, 0x4c, 0x57, 0x89, 0x40, 0x0a, 0xcf, 0xe4,
+  0x15, 0xe2, 0xbd, 0x82, 0xe3, 0x0f, 0x95, 0x96, 0x7e, 0x2a, 0xa0, 0xb9,
+  0x4a, 0xa3, 0xe0, 0x5a, 0xe4, 0xd9, 0xb8, 0x61, 0xfc, 0x6a, 0x40, 0xf9,
+  0xb3, 0x70, 0x33, 0x2b, 0x14, 0x6b, 0x76, 0x01, 0x1d, 0x2c, 0xe8, 0x4a,
+  0xb5, 0x47, 0x6d, 0x5b, 0xe9, 0xa3, 0x3e, 0xc0, 0xdd, 0xaf, 0x17, 0x85,
+  0x83, 0x02, 0x96, 0xae, 0x43, 0xbf, 0xfd, 0xf1, 0xd7, 0xb6, 0xee, 0x36,
+  0xf0, 0x4c, 0xc5, 0x86, 0x65, 0x29, 0xd6, 0x3b, 0x4c, 0x32, 0x64, 0x08,
+  0xac, 0xe2, 0xf4, 0x9c, 0x4c, 0x68, 0x98, 0x8b, 0x4c, 0x2c, 0x63, 0x16,
+  0x5a, 0x02, 0x31, 0xf3, 0x43, 0xe1, 0x51, 0xd8, 0xee, 0x9c, 0x3a, 0xeb,
+  0xf2, 0xae, 0x40, 0xdf, 0x31, 0x7e, 0x50, 0x40, 0x74, 0x3b, 0xe7, 0xae,
+  0x28, 0xef, 0x51, 0xf8, 0x0a, 0xef, 0x75, 0xc9, 0x23, 0x72, 0x43, 0xec,
+  0x3c, 0xa2, 0xe2, 0xb8, 0x16, 0xd1, 0xd4, 0x86, 0xd1, 0x76, 0x8e, 0xc2,
+  0x73, 0x11, 0xfa, 0x92, 0xac, 0x48, 0x92, 0x87, 0x50, 0x56, 0xcc, 0x23,
+  0x34, 0x11, 0xba, 0x57, 0x3d, 0x8e, 0x2a, 0xb3, 0x1f, 0x44, 0x02, 0x6a,
+  0x4e, 0x75, 0xa1, 0x98, 0xad, 0x42, 0xba, 0x87, 0x22, 0x7d, 0x3d, 0x14,
+  0xd5, 0xb2, 0xf7, 0x1c, 0xf0, 0xdd, 0xd0, 0xb2, 0xf0, 0x06, 0x49, 0x18,
+  0x26, 0x4a, 0xf5, 0x18, 0xd2, 0x9e, 0x4b, 0x5d, 0x11, 0x61, 0xad, 0x39,
+  0x92, 0x9b, 0x09, 0x90, 0x81, 0x56, 0xa5, 0xdc, 0xa6, 0x0d, 0x3c, 0x5a,
+  0x21, 0xf5, 0x43, 0xcd, 0x87, 0x73, 0x20, 0x47, 0xb8, 0x0b, 0x2b, 0x07,
+  0x2d, 0xa3, 0x9b, 0x44, 0x01, 0xd8, 0x50, 0xe9, 0x6f, 0x10, 0x7b, 0x14,
+  0x92, 0x65, 0x4b, 0x95, 0xae, 0x07, 0xcc, 0x1c, 0xba, 0xdb, 0x89, 0xf3,
+  0x9c, 0xc5, 0x64, 0xdc, 0x0a, 0xcf, 0x61, 0x94, 0x91, 0xe5, 0x35, 0xbe,
+  0x4c, 0x29, 0x2c, 0xf0, 0xbf, 0x0a, 0xc6, 0x1b, 0xc2, 0x58, 0xa6, 0x17,
+  0x3c, 0x5a, 0x5f, 0xba, 0xe4, 0x3c, 0x55, 0x23, 0xbc, 0x50, 0xac, 0x02,
+  0xc8, 0xe5, 0x20, 0x11, 0xb5, 0x36, 0x0c, 0x2f, 0xc1, 0x23, 0x22, 0x68,
+  0x4b, 0x85, 0x54, 0x1f, 0xc9, 0xac, 0x3e, 0x38, 0xd0, 0x12, 0xa4, 0x37,
+  0xe9, 0x24, 0x68, 0x1d, 0x78, 0xfa, 0xc9, 0x59, 0xc2, 0x1e, 0x8c, 0xce,
+  0x79, 0xbc, 0x18, 0x2e, 0xaf, 0x94, 0x74, 0x97, 0x16, 0xa4, 0x77, 0x30,
+  0xb3, 0xd7, 0x08, 0x23, 0xc8, 0xce, 0x39, 0x01, 0x87, 0xfd, 0x92, 0x4a,
+  0x8d, 0xa8, 0x1b, 0x4b, 0x1f, 0xa4, 0x87, 0x8c, 0x48, 0xca, 0x90, 0x46,
+  0x6b, 0x66, 0x22, 0xb7, 0xf9, 0x3d, 0xe7, 0xbf, 0x2d, 0x7d, 0x4e, 0x91,
+  0x48, 0x0e, 0x7b, 0xb1, 0x10, 0xee, 0x57, 0x76, 0xc9, 0x67, 0x3c, 0xf1,
+  0xd9, 0x25, 0x74, 0xcc, 0x60, 0xa7, 0x94, 0x7d, 0xfb, 0xcb, 0x7f, 0x33,
+  0x05, 0xff, 0x3d, 0x33, 0x1c, 0xfa, 0x5e, 0x5e, 0x74, 0xce, 0xfb, 0x87,
+  0x98, 0xe1, 0x01, 0xa5, 0xfe, 0xbc, 0x29, 0x17, 0x9e, 0x4c, 0x6f, 0xda,
+  0x55, 0x77, 0x51, 0xfa, 0x85, 0x52, 0xb8, 0xfc, 0xe2, 0x00, 0xe9, 0x82,
+  0x6a, 0x34, 0xd4, 0x90, 0xe4, 0x96, 0xf1, 0x39, 0xf7, 0x25, 0xc7, 0xb9,
+  0x73, 0xe7, 0xd1, 0x8a, 0x3f, 0xe1, 0xc5, 0x8f, 0x66, 0x9f, 0xc0, 0x63,
+  0xf4, 0xe0, 0x14, 0x27, 0xd0, 0x99, 0xa3, 0x5f, 0x47, 0xae, 0x94, 0x95,
+  0x16, 0xdc, 0x28, 0x90, 0x92, 0x2d, 0xb2, 0x2c, 0x4e, 0x47, 0x6d, 0x18,
+  0x46, 0xda, 0xeb, 0x34, 0x1d, 0xed, 0xef, 0xb7, 0x61, 0xfe, 0x80, 0x47,
+  0x7c, 0xc2, 0x91, 0x15, 0x27, 0x60, 0x88, 0x43, 0x3d, 0x87, 0x5b, 0x92,
+  0xde, 0x8f, 0x05, 0xbd, 0x45, 0x04, 0xa7, 0xfc, 0xc8, 0xda, 0xfb, 0x6b,
+  0xba, 0x51, 0x84, 0x29, 0x37, 0x0a, 0xa3, 0xb8, 0xd4, 0x58, 0xa7, 0x77,
+  0x08, 0xa9, 0x3e, 0xf2, 0x81, 0x95, 0x9b, 0x06, 0x67, 0x39, 0x79, 0x1b,
+  0x37, 0x1e, 0xd6, 0x97, 0x85, 0x08, 0x82, 0x68, 0xf4, 0xdd, 0x26, 0xbf,
+  0xca, 0xd9, 0x7e, 0xb1, 0xcb, 0x10, 0xed, 0xf4, 0x36, 0x74, 0xdb, 0x52,
+  0x2d, 0xc4, 0x89, 0x1b, 0x44, 0xa9, 0xa8, 0x94, 0xc8, 0x47, 0x4d, 0xfc,
+  0x38, 0xa4, 0xe7, 0xf4, 0x93, 0x9f, 0x2d, 0xac, 0x36, 0x7e, 0x9f, 0xf4,
+  0x53, 0x36, 0x5d, 0xa5, 0xb7, 0x90, 0x74, 0x76, 0x48, 0x70, 0xee, 0xa7,
+  0x6e, 0x2e, 0x04, 0xd6, 0xa6, 0x2c, 0xb9, 0x95, 0x9f, 0x2c, 0xc9, 0x3e,
+  0x90, 0x51, 0xae, 0xa0, 0xba, 0x47, 0xab, 0xcc, 0xd2, 0xa6, 0xe9, 0xe0,
+  0xcf, 0x28, 0x7b, 0x06, 0x87, 0x14, 0x90, 0x0f, 0x50, 0x96, 0x36, 0x81,
+  0x0a, 0x61, 0x42, 0x27, 0xf1, 0x2c, 0x83, 0x9a, 0x76, 0xdb, 0x72, 0x87,
+  0x09, 0x7c, 0x15, 0xa3, 0x34, 0xc7, 0x5e, 0x96, 0xfd, 0xe9, 0xf2, 0xfd,
+  0x3b, 0x87, 0x6e, 0x54, 0x25, 0xa4, 0x83, 0xeb, 0x2a, 0x25, 0xe0, 0xa3,
+  0x13, 0xab, 0x09, 0xad, 0xa4, 0xdf, 0x38, 0xc2, 0x30, 0x30, 0xab, 0xa0,
+  0x86, 0x87, 0x09, 0x2d, 0xb6, 0x4b, 0x63, 0xa3, 0xbc, 0x50, 0x98, 0x30,
+  0xbd, 0x2d, 0x57, 0xcc, 0x69, 0x91, 0x2e, 0x18, 0x4a, 0x20, 0xea, 0xca,
+  0xa1, 0x3c, 0x13, 0x9b, 0x00, 0xf0, 0x8e, 0xe7, 0xeb, 0xd1, 0xd5, 0x32,
+  0x70, 0x69, 0x82, 0x2d, 0xde, 0x71, 0x96, 0x85, 0x24, 0x9e, 0x7f, 0x22,
+  0x70, 0xe8, 0x6b, 0x0f, 0xb6, 0x7d, 0x8e, 0x1c, 0x03, 0xad, 0xb6, 0xfc,
+  0xe9, 0x58, 0xbb, 0x8e, 0x54, 0x16, 0x50, 0x55, 0x51, 0x02, 0xd2, 0xe3,
+  0x7f, 0xc3, 0x40, 0x50, 0x61, 0x4a, 0x83, 0x76, 0x98, 0x49, 0x81, 0xe6,
+  0x66, 0xc4, 0x9d, 0x46, 0x90, 0xa5, 0x79, 0x88, 0xe1, 0xa7, 0x37, 0x46,
+  0xe5, 0x6b, 0x02, 0xbb, 0xa4, 0x63, 0xe5, 0x2c, 0x84, 0x4b, 0xce, 0xb9,
+  0x2b, 0xba, 0x0a, 0x27, 0x06, 0x01, 0xa2, 0x88, 0x2d, 0xb1, 0xdd, 0x54,
+  0x8e, 0x08, 0x91, 0x9b, 0xda, 0x55, 0x8f, 0x2d, 0x64, 0xae, 0xdc, 0x47,
+  0x97, 0x5e, 0x7f, 0x62, 0xef, 0xa7, 0xd8, 0x67, 0x38, 0xa0, 0x4b, 0x7f,
+  0x1e, 0x5a, 0xe6, 0xa6, 0xd4, 0xa3, 0x8d, 0x77, 0x18, 0x1c, 0xe7, 0x21,
+  0x0a, 0xb7, 0xca, 0x1d, 0xb6, 0xd4, 0x54, 0xf5, 0x5a, 0x7b, 0xd7, 0xd8,
+  0xaf, 0xa0, 0xa9, 0xab, 0xa0, 0xbc, 0xc7, 0xa8, 0xe2, 0xa9, 0xbe, 0xa8,
+  0x56, 0xee, 0x5e, 0x87, 0x30, 0x7f, 0xf8, 0x5e, 0x7e, 0xf3, 0xa6, 0x8b,
+  0x1d, 0x5d, 0x17, 0x6c, 0x8b, 0x74, 0x69, 0x90, 0xb5, 0x9a, 0x99, 0x2a,
+  0xdd, 0xb5, 0xab, 0xb8, 0x31, 0xc5, 0x1d, 0xef, 0x35, 0x5e, 0xdc, 0x93,
+  0xd4, 0x52, 0x11, 0xe6, 0x85, 0xa5, 0xe9, 0x02, 0xcd, 0xe3, 0xbf, 0xfa,
+  0xd4, 0x56, 0xbd, 0x7a, 0x2a, 0x3e, 0x7a, 0x7f, 0xb7, 0x29, 0xb0, 0xb7,
+  0x7f, 0xff, 0xdb, 0x97, 0x9c, 0xb7, 0x10, 0x2f, 0x5b, 0x02, 0xff, 0x37,
+  0xe1, 0x5d, 0x99, 0x43, 0x9e, 0x71, 0x54, 0x17, 0x46, 0x79, 0x73, 0xb4,
+  0x6b, 0x1c, 0xba, 0xca, 0x64, 0xec, 0x26, 0xef, 0xcf, 0xf2, 0x5b, 0xdc,
+  0x9c, 0x6f, 0x9c, 0xd1, 0x55, 0x69, 0xc7, 0x1b, 0x36, 0x7d, 0x39, 0x2e,
+  0x23, 0x4b, 0xdd, 0x8f, 0x23, 0x50, 0xf3, 0x35, 0xf0, 0xa6, 0x3a, 0x33,
+  0xea, 0x53, 0x6a, 0xd3, 0xa2, 0xf1, 0xf9, 0x47, 0x03, 0xdd, 0x25, 0x49,
+  0x69, 0x4a, 0x6d, 0x92, 0xa3, 0x16, 0x83, 0x54, 0xdb, 0x1f, 0x9c, 0x29,
+  0xcc, 0xc8, 0x34, 0xc9, 0xea, 0xcf, 0x4a, 0x75, 0xe2, 0xe5, 0x2f, 0x4e,
+  0x65, 0xe8, 0xf1, 0x5e, 0xe5, 0xc3, 0xda, 0x2e, 0x06, 0x0c, 0x42, 0xd2,
+  0xab, 0x73, 0x15, 0xd6, 0x07, 0x5b, 0xfa, 0x65, 0x04, 0xa0, 0xe4, 0xc5,
+  0xe5, 0xc1, 0x1f, 0xd4, 0x1e, 0xa2, 0xd4, 0x62, 0x36, 0xaf, 0x6a, 0xdb,
+  0x2e, 0x86, 0xd5, 0x39, 0x54, 0xa3, 0x57, 0xbc, 0x3a, 0xa5, 0x3e, 0x52,
+  0x1f, 0x0a, 0x95, 0xd2, 0xd5, 0x37, 0x43, 0x35, 0x38, 0x36, 0x18, 0x01,
+  0x24, 0xd3, 0x0a, 0xa8, 0x96, 0x7c, 0x80, 0xff, 0x2c, 0xbf, 0x44, 0x6e,
+  0xcd, 0xab, 0xcd, 0x00, 0x7f, 0x10, 0x5f, 0x3f, 0xb9, 0xf1, 0x60, 0x15,
+  0xe7, 0x4d, 0x27, 0x27, 0x62, 0x19, 0x5d, 0x8b, 0xdd, 0x87, 0xcf, 0x66,
+  0xfa, 0xf4, 0x82, 0x44, 0xdd, 0x18, 0xcb, 0x68, 0x95, 0x0a, 0x2f, 0x5a,
+  0xe3, 0xed, 0x82, 0x56, 0x8c, 0xbd, 0x1b, 0x27, 0x8b, 0x56, 0xee, 0x82,
+  0x5a, 0x13, 0xb4, 0xa2, 0xb8, 0xce, 0x0b, 0x3a, 0x3c, 0x41, 0x27, 0x47,
+  0x85, 0xfb, 0x5c, 0xcc, 0xf8, 0x0a, 0x8c, 0x00, 0x94, 0x34, 0x55, 0x6a,
+  0x09, 0x3a, 0x6c, 0x03, 0x16, 0x86, 0x24, 0x7d, 0x2d, 0xd4, 0xd7, 0x40,
+  0x56, 0x58, 0x46, 0x29, 0x88, 0x8e, 0x43, 0x1d, 0xfd, 0x9b, 0x64, 0x6f,
+  0x15, 0xc3, 0x39, 0xf2, 0x11, 0xf6, 0xc9, 0xdd, 0x24, 0x0f, 0x20, 0xb4,
+  0x7e, 0x76, 0xf1, 0x5e, 0x37, 0xc0, 0x57, 0xf5, 0x0f, 0x18, 0x24, 0x96,
+  0x7a, 0x51, 0xbb, 0xff, 0x8e, 0xd9, 0xdc, 0x38, 0xc3, 0x99, 0x45, 0xc9,
+  0x05, 0xa7, 0x39, 0x05, 0xdf, 0xdf, 0x41, 0x62, 0x57, 0xb2, 0xdc, 0x75,
+  0x2d, 0xa3, 0xe1, 0x3a, 0x86, 0x39, 0x95, 0x7b, 0xdd, 0x79, 0x95, 0x83,
+  0xff, 0x18, 0xa9, 0x5d, 0x41, 0xa8, 0x7c, 0xe5, 0x6f, 0xc0, 0x82, 0x86,
+  0xd2, 0xfd, 0x6a, 0xc4, 0x49, 0x81, 0x6e, 0x55, 0x2d, 0xae, 0x89, 0xb5,
+  0x15, 0x2b, 0xc5, 0xd7, 0xf8, 0x1d, 0x84, 0xab, 0xe3, 0x9e, 0x5d, 0x8f,
+  0xf8, 0xfb, 0xb9, 0x2a, 0x67, 0x90, 0x47, 0xc6, 0xeb, 0xff, 0x22, 0x7f,
+  0x98, 0xc2, 0x99, 0x07, 0xc0, 0x44, 0xa0, 0x5f, 0x31, 0xbe, 0x70, 0x2e,
+  0x30, 0x16, 0x94, 0xcf, 0xcb, 0x54, 0x41, 0xff, 0xf6, 0x0d, 0x52, 0x87,
+  0xa5, 0x3f, 0x01, 0x76, 0x9a, 0xbf, 0xa2, 0x4b, 0xf7, 0xcb, 0x87, 0x94,
+  0xf1, 0xe9, 0xbe, 0xfa, 0x4d, 0x0b, 0x3b, 0xdd, 0x97, 0x3f, 0x19, 0xdc,
+  0xa7, 0x7f, 0xcd, 0xf8, 0x3f, 0xbd, 0xf8, 0x82, 0xc2, 0xdd, 0x38, 0x00,
+  0x00,
+};
@@ -0,0 +1,101 @@
+"""Generate include/web_ui.h from web/index.html.
+
+Runs as a PlatformIO pre-build step (extra_scripts = pre:scripts/build_web_ui.py)
+and can also be invoked directly: python3 scripts/build_web_ui.py
+
+The page is minified, gzipped and emitted as a byte array together with its
+length and a content hash used as the HTTP ETag. The header is only rewritten
+when the hash changes so incremental builds stay incremental.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE = os.path.join(PROJECT_DIR, "web", "index.html")
+OUTPUT = os.path.join(PROJECT_DIR, "include", "web_ui.h")
+
+BLOCK_RE = re.compile(r"(<style>.*?</style>|<script>.*?</script>)", re.S)
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{};,>])\s*", r"\1", css)
+    css = re.sub(r":\s+", ":", css)
+    return css.replace(";}", "}").strip()
+
+
+def minify_js(js):
+    # Line-oriented on purpose: lines are never joined, so automatic semicolon
+    # insertion and string/regex literals are left untouched.
+    out = []
+    for line in js.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        out.append(line)
+    return "\n".join(out)
+
+
+def minify_html(html):
+    parts = []
+    for chunk in BLOCK_RE.split(html):
+        if chunk.startswith("<style>"):
+            parts.append("<style>" + minify_css(chunk[7:-8]) + "</style>")
+        elif chunk.startswith("<script>"):
+            parts.append("<script>" + minify_js(chunk[8:-9]) + "</script>")
+        else:
+            chunk = re.sub(r"<!--.*?-->", "", chunk, flags=re.S)
+            chunk = re.sub(r">\s+<", "><", chunk)
+            chunk = re.sub(r"\s+", " ", chunk)
+            parts.append(chunk)
+    return "".join(parts).strip()
+
+
+def render_header(payload, etag, raw_len):
+    lines = [
+        "#pragma once",
+        "",
+        "// Generated by scripts/build_web_ui.py from web/index.html - do not edit.",
+        "// Source %d bytes, minified + gzipped %d bytes." % (raw_len, len(payload)),
+        "",
+        "#include <Arduino.h>",
+        "",
+        'static const char WEB_UI_ETAG[] = "\\"%s\\"";' % etag,
+        "static const size_t WEB_UI_GZ_LEN = %d;" % len(payload),
+        "static const uint8_t WEB_UI_GZ[] PROGMEM = {",
+    ]
+    for i in range(0, len(payload), 12):
+        row = ", ".join("0x%02x" % b for b in payload[i:i + 12])
+        lines.append("  " + row + ",")
+    lines.append("};")
+    return "\n".join(lines) + "\n"
+
+
+def build():
+    with open(SOURCE, "r", encoding="utf-8") as f:
+        raw = f.read()
+    minified = minify_html(raw).encode("utf-8")
+    # mtime=0 keeps the gzip stream (and therefore the header) reproducible.
+    payload = gzip.compress(minified, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(minified).hexdigest()[:16]
+    header = render_header(payload, etag, len(raw.encode("utf-8")))
+
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, "r", encoding="utf-8") as f:
+            if f.read() == header:
+                return
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(header)
+    print("web_ui.h: %d -> %d bytes (etag %s)" % (len(raw), len(payload), etag))
+
+
+build()
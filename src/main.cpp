@@ -1,10 +1,19 @@
 #include <Arduino.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
+#include <string>
 
+#include <Preferences.h>
 #include <WiFi.h>
+#include <driver/pcnt.h>
+#include <esp_wifi.h>
+#include <fcntl.h>
+#include <lwip/sockets.h>
+#include <unistd.h>
 #include <HTTPSServer.hpp>
 #include <HTTPRequest.hpp>
 #include <HTTPResponse.hpp>
@@ -12,8 +21,22 @@
 #include <WebsocketHandler.hpp>
 #include <WebsocketNode.hpp>
 
+#include "actuator.h"
+#include "admission.h"
+#include "async_log.h"
+#include "boot_phases.h"
+#include "car_config.h"
 #include "cert_der.h"
+#include "channel_select.h"
+#include "control.h"
 #include "key_der.h"
+#include "liveness.h"
+#include "loop_stats.h"
+#include "maneuver.h"
+#include "metrics.h"
+#include "protocol.h"
+#include "speed_control.h"
+#include "tls_budget.h"
 #include "web_ui.h"
 
 using namespace httpsserver;
@@ -21,35 +44,54 @@ using namespace httpsserver;
 // ====== User settings ======
 const char *ssid = "RC_Car_AP";
 const char *password = "RCcar1234";
+constexpr uint8_t apChannel = 0;               // 0 = pick the quietest channel at boot
 
-const int servoPin = 19;      // GPIO connected to servo signal
-const int servoMin = 40;      // Servo angle minimum
-const int servoMax = 130;     // Servo angle maximum
-constexpr int servodirection_inverse = 1;
-const float tiltMin = -45.0f; // phone tilt min (degrees)
-const float tiltMax = +45.0f; // phone tilt max
-
-const int motorPwmPin = 18;   // GPIO connected to ESC / motor driver input
-const int headlightPin = 33;  // GPIO connected to headlight
-
-constexpr uint8_t MAX_WS_CLIENTS = 4;
-
-// ====== Servo PWM config ======
-constexpr uint8_t servoChannel = 0;
-constexpr uint32_t servoFreq = 50;          // 50 Hz for standard servos
-constexpr uint8_t servoResolution = 15;     // 15-bit resolution
-constexpr int servoPulseMinUs = 922;        // Minimum pulse width for 40°
-constexpr int servoPulseMaxUs = 1872;       // Maximum pulse width for 130°
-constexpr uint32_t servoPeriodUs = 20000;   // 20 ms period at 50 Hz
-
-// ====== Motor PWM config ======
-constexpr uint8_t motorChannel = 1;
-constexpr uint32_t motorFreq = 20000;       // 20 kHz to keep motor drive quiet
-constexpr uint8_t motorResolution = 12;     // 12-bit resolution for duty control
-constexpr float motorDutyMax = 1.0f;
-constexpr float motorAccelPerMs = 1.0f / 600.0f; // reach full throttle in ~0.6s
-constexpr float motorDecelPerMs = 1.0f / 900.0f; // coast down a bit slower
-constexpr uint32_t motorUpdateIntervalMs = 20;
+// ====== Radio profile ======
+constexpr uint32_t apScanMsPerChannel = 60;    // active scan dwell per channel
+constexpr size_t maxScanResults = 32;
+
+// ====== Connection budgets ======
+constexpr uint8_t MAX_HTTP_CONNECTIONS = 2;    // page loads (closed after the reply) and /metrics (kept alive)
+constexpr uint8_t MAX_WS_CLIENTS = 4;          // WebSocket sessions, one held for the driver
+constexpr uint8_t MAX_CONNECTIONS = MAX_HTTP_CONNECTIONS + MAX_WS_CLIENTS;
+constexpr uint32_t driverReconnectGraceMs = 15000;
+// A session silent for wsPingIntervalMs is pinged; one that leaves
+// wsPingMissLimit pings unanswered is evicted, here after 0.9 s of silence.
+constexpr uint32_t wsPingIntervalMs = 300;
+constexpr uint8_t wsPingMissLimit = 2;
+// New TLS connections are refused (RST) once accepting one would leave less
+// than this free: room for a handshake's transient buffers plus Wi-Fi/lwIP.
+constexpr uint32_t tlsHeapReserveBytes = 48 * 1024;
+
+// ====== Traffic stats ======
+constexpr uint32_t statsReportIntervalMs = 5000;
+
+// ====== Main loop scheduling ======
+constexpr uint32_t activeMaxWaitUs = 50000;  // longest block while a phone is associated
+constexpr uint32_t idleMaxWaitUs = 200000;   // longest block with nobody on the AP
+constexpr uint32_t netBurstUs = 3000;        // keep polling this long after socket activity
+constexpr uint32_t activeCpuMhz = 240;
+constexpr uint32_t idleCpuMhz = 80;          // lowest clock that keeps Wi-Fi running
+
+// ====== Logging ======
+// LOG_* records are formatted and printed by a low-priority task on core 0,
+// away from the loop task that runs the server and the control tick.
+constexpr uint32_t logDrainIntervalMs = 20;
+constexpr uint32_t logTaskStackBytes = 3072;
+constexpr unsigned logTaskPriority = tskIDLE_PRIORITY + 1;
+constexpr int logTaskCore = 0;
+
+// ====== Boot ======
+// The Wi-Fi scan and AP bring-up run in their own task on core 0 while the
+// loop core parses the TLS key and opens the listener.
+constexpr uint32_t apTaskStackBytes = 4096;
+constexpr unsigned apTaskPriority = tskIDLE_PRIORITY + 2;
+constexpr int apTaskCore = 0;
+
+// ====== Maneuvers ======
+// The last uploaded maneuver script is kept in NVS and reloaded at boot.
+const char maneuverNvsNamespace[] = "maneuver";
+const char maneuverNvsKey[] = "script";
 
 // ====== Globals ======
 int currentAngle = 90;   // start at center
@@ -57,19 +99,217 @@ float currentTilt = 0.0; // track the last requested tilt
 float motorDuty = 0.0f;
 bool gasPressed = false;
 unsigned long lastMotorUpdateMs = 0;
-float lastBroadcastMotorDuty = -1.0f;
+unsigned long lastSpeedSampleMs = 0;
+uint32_t lastMotorCorrectionMs = 0;
 bool headlightOn = false;
 
+// Wheel encoder, only used when the profile has an encoderPin. The PCNT unit
+// counts rising edges in hardware; the control tick reads the count, no
+// per-edge interrupt.
+constexpr pcnt_unit_t encoderUnit = PCNT_UNIT_0;
+constexpr int16_t encoderCountLimit = 32767;  // counter wraps to 0 here
+int16_t lastEncoderCount = 0;
+EncoderSpeed wheelSpeed(Vehicle::encoderPulsesPerMeter);
+SpeedController speedController(speedGainsFor<Vehicle>());
+
+unsigned long lastStatsReportMs = 0;
+
+BootPhases bootPhases;
+bool bootReported = false;
+
+Maneuver storedManeuver;
+ManeuverPlayer maneuverPlayer;
+Preferences maneuverStore;
+
+// ====== Metrics (served on /metrics) ======
+// Indexed by Command, Invalid included.
+Counter framesSync("rc_ws_frames_received_total", "command=\"sync\"", "WebSocket frames received by command");
+Counter framesGasOn("rc_ws_frames_received_total", "command=\"gas_on\"", "");
+Counter framesGasOff("rc_ws_frames_received_total", "command=\"gas_off\"", "");
+Counter framesHandbrake("rc_ws_frames_received_total", "command=\"handbrake\"", "");
+Counter framesHeadlightOn("rc_ws_frames_received_total", "command=\"headlight_on\"", "");
+Counter framesHeadlightOff("rc_ws_frames_received_total", "command=\"headlight_off\"", "");
+Counter framesHello("rc_ws_frames_received_total", "command=\"hello\"", "");
+Counter framesPong("rc_ws_frames_received_total", "command=\"pong\"", "");
+Counter framesManeuver("rc_ws_frames_received_total", "command=\"maneuver\"", "");
+Counter framesManeuverRun("rc_ws_frames_received_total", "command=\"maneuver_run\"", "");
+Counter framesTilt("rc_ws_frames_received_total", "command=\"tilt\"", "");
+Counter framesInvalid("rc_ws_frames_received_total", "command=\"invalid\"", "");
+Counter *const framesByCommand[] = {&framesSync, &framesGasOn, &framesGasOff, &framesHandbrake,
+                                    &framesHeadlightOn, &framesHeadlightOff, &framesHello, &framesPong,
+                                    &framesManeuver, &framesManeuverRun, &framesTilt, &framesInvalid};
+static_assert(sizeof(framesByCommand) / sizeof(framesByCommand[0]) == static_cast<size_t>(Command::Invalid) + 1,
+              "framesByCommand must cover every Command");
+
+const char invalidInputReply[] = "{\"error\":\"invalid_input\"}";
+const char busyReply[] = "{\"error\":\"busy\"}";
+const char pingFrame[] = "{\"ping\":1}";
+const char maneuverRunningReply[] = "{\"error\":\"maneuver_running\"}";
+const char noManeuverReply[] = "{\"error\":\"no_maneuver\"}";
+Counter parseErrors("rc_ws_parse_errors_total", "", "Frames answered with invalid_input");
+Counter stateFramesSent("rc_ws_state_frames_sent_total", "", "State frames sent to clients");
+Counter rampFramesSent("rc_ws_ramp_frames_sent_total", "", "Motor ramp frames sent to clients");
+Counter wsBytesSent("rc_bytes_sent_total", "channel=\"ws\"", "Payload bytes sent");
+Counter httpBytesSent("rc_bytes_sent_total", "channel=\"http\"", "");
+Counter rejectedTcp("rc_connections_rejected_total", "stage=\"tcp\"", "Connections turned away by admission control");
+Counter rejectedHttp("rc_connections_rejected_total", "stage=\"http\"", "");
+Counter rejectedWs("rc_connections_rejected_total", "stage=\"ws\"", "");
+Counter rejectedHeap("rc_connections_rejected_total", "stage=\"heap\"", "");
+Counter wsPingsSent("rc_ws_pings_sent_total", "", "Liveness pings sent to silent clients");
+Counter wsEvictions("rc_ws_evictions_total", "", "Sessions closed after unanswered pings");
+Counter tlsHandshakes("rc_tls_handshakes_total", "", "Completed TLS handshakes (accepted connections)");
+Gauge wheelSpeedGauge("rc_wheel_speed_mm_per_second", "", "Encoder wheel speed");
+Counter wheelspinTicks("rc_wheelspin_ticks_total", "", "Control ticks with wheelspin detected");
+Counter maneuversCompleted("rc_maneuver_runs_total", "result=\"completed\"", "Maneuver script runs by outcome");
+Counter maneuversAborted("rc_maneuver_runs_total", "result=\"aborted\"", "");
+
+ConnectionHeapModel connectionHeap;
+uint32_t tlsCapacity();
+Gauge tlsHeapPerConnection("rc_tls_connection_heap_bytes", "", "Measured heap held by one TLS connection");
+CallbackMetric tlsCapacityGauge("rc_tls_connection_capacity", "", "TLS connections that fit in the current free heap",
+                                MetricType::Gauge, &tlsCapacity);
+
+uint32_t countWsClients();
+CallbackMetric wsClientsGauge("rc_ws_clients", "", "Connected WebSocket clients", MetricType::Gauge, &countWsClients);
+CallbackMetric freeHeapGauge("rc_free_heap_bytes", "", "Free heap", MetricType::Gauge,
+                             [] { return static_cast<uint32_t>(ESP.getFreeHeap()); });
+CallbackMetric minFreeHeapGauge("rc_min_free_heap_bytes", "", "Lowest free heap since boot", MetricType::Gauge,
+                                [] { return static_cast<uint32_t>(ESP.getMinFreeHeap()); });
+CallbackMetric logDrops("rc_log_records_dropped_total", "", "Log records dropped because the log ring was full",
+                        MetricType::Counter, [] { return asyncLog().dropped(); });
+// /metrics is served from the loop task, so the current task is the one measured.
+CallbackMetric loopStackGauge("rc_task_stack_free_min_bytes", "task=\"loop\"", "Task stack high-water mark",
+                              MetricType::Gauge, [] { return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(nullptr)); });
+TaskHandle_t logTask = nullptr;
+CallbackMetric logStackGauge("rc_task_stack_free_min_bytes", "task=\"log\"", "", MetricType::Gauge,
+                             [] { return static_cast<uint32_t>(uxTaskGetStackHighWaterMark(logTask)); });
+// The AP task deletes itself once the AP is up, before any phone can reach
+// /metrics, so it records its mark on the way out.
+volatile uint32_t apTaskStackFreeMin = 0;
+CallbackMetric apStackGauge("rc_task_stack_free_min_bytes", "task=\"ap\"", "", MetricType::Gauge,
+                            [] { return static_cast<uint32_t>(apTaskStackFreeMin); });
+
+uint32_t lastReportFrames = 0;
+uint32_t lastReportTiltFrames = 0;
+uint32_t lastReportStatesSent = 0;
+
+StateFrameCache stateFrames;
+
+LoopStats loopStats;
+uint32_t lastNetActivityUs = 0;
+uint32_t netWakeUs = 0;
+bool netWakePending = false;
+volatile bool stationsPresent = false;
+
+Actuator servoActuator(servoPeriodUs, servoCommitWindowUs);
+Actuator motorActuator(motorPeriodUs, motorPeriodUs);
+Actuator headlightActuator(0, 0);
+
+// HTTPSServer with admission control and connection accounting.
+//
+// When every slot is taken, pending TCP connections are accepted and reset
+// right away instead of waiting in the backlog for a TLS handshake. Budgets
+// per connection kind are enforced later (handlers / WebSocket admission),
+// because the kind is only known once the request line has been read.
+//
+// A slot that was empty or closed before loop() and holds an open connection
+// afterwards was accepted in that pass, and accepting runs the TLS handshake
+// to completion. A failed handshake leaves the slot holding a closed one.
+class CarHttpsServer : public HTTPSServer {
+public:
+  CarHttpsServer(SSLCert *cert, uint16_t port) : HTTPSServer(cert, port, MAX_CONNECTIONS) {}
+
+  void loop() {
+    bool wasOpen[MAX_CONNECTIONS];
+    uint8_t open = 0;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; ++i) {
+      wasOpen[i] = _connections[i] != nullptr && !_connections[i]->isClosed();
+      if (wasOpen[i]) ++open;
+    }
+    if (open == MAX_CONNECTIONS) {
+      rejectPending(rejectedTcp);
+    } else if (!connectionHeap.admitAnother(ESP.getFreeHeap(), tlsHeapReserveBytes)) {
+      rejectPending(rejectedHeap);
+    }
+
+    HTTPSServer::loop();
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; ++i) {
+      if (!wasOpen[i] && _connections[i] != nullptr && !_connections[i]->isClosed()) tlsHandshakes.inc();
+    }
+
+    // Until the AP is up, Wi-Fi is still allocating; a baseline taken then
+    // would charge that heap to the first connection.
+    const uint8_t nowOpen = openConnections();
+    if (nowOpen != lastOpen_ && bootPhases.reached(BootPhase::Ready)) {
+      lastOpen_ = nowOpen;
+      const uint32_t freeHeap = ESP.getFreeHeap();
+      connectionHeap.sample(nowOpen, freeHeap);
+      tlsHeapPerConnection.set(connectionHeap.perConnectionBytes());
+      LOG_INFO("TLS: %u open, %u bytes each, %u free, capacity %u", nowOpen, connectionHeap.perConnectionBytes(),
+               freeHeap, connectionHeap.capacity(nowOpen, freeHeap, tlsHeapReserveBytes));
+    }
+  }
+
+  uint8_t openConnections() const {
+    uint8_t open = 0;
+    for (uint8_t i = 0; i < MAX_CONNECTIONS; ++i) {
+      if (_connections[i] != nullptr && !_connections[i]->isClosed()) ++open;
+    }
+    return open;
+  }
+
+private:
+  uint8_t lastOpen_ = UINT8_MAX;
+
+  void rejectPending(Counter &reason) {
+    for (;;) {
+      fd_set readSet;
+      FD_ZERO(&readSet);
+      FD_SET(_socket, &readSet);
+      timeval immediate = {0, 0};
+      if (select(_socket + 1, &readSet, nullptr, nullptr, &immediate) <= 0) return;
+      const int fd = accept(_socket, nullptr, nullptr);
+      if (fd < 0) return;
+      linger reset = {1, 0};  // RST instead of a FIN handshake
+      setsockopt(fd, SOL_SOCKET, SO_LINGER, &reset, sizeof(reset));
+      close(fd);
+      reason.inc();
+    }
+  }
+};
+
 SSLCert cert(serverCertDer, serverCertDerLen, serverKeyDer, serverKeyDerLen);
-HTTPSServer secureServer(&cert, 443, MAX_WS_CLIENTS);
+CarHttpsServer secureServer(&cert, 443);
 
 void handleRoot(HTTPRequest *req, HTTPResponse *res);
 void handle404(HTTPRequest *req, HTTPResponse *res);
+void handleMetrics(HTTPRequest *req, HTTPResponse *res);
 void updateMotorControl();
 void writeMotorDuty(float duty);
 void applyHandbrake();
 void broadcastState();
+void broadcastRamp();
 void setHeadlight(bool on);
+void applyTilt(float tilt);
+void setGas(bool on);
+void startManeuver();
+void abortManeuver();
+void loadManeuver();
+void reportStats();
+void serviceActuators();
+void waitForWork();
+void updatePowerMode();
+void onStationsChanged(WiFiEvent_t event);
+uint8_t selectApChannel();
+void applyRadioProfile();
+void noteCommandApplied();
+void setupEncoder();
+void startLogTask();
+void startAccessPointTask(void *);
+void reportBoot();
+void logTlsBufferConfig();
+uint32_t readEncoderPulses();
+void serviceWsLiveness();
 
 class SteeringWebsocket : public WebsocketHandler {
 public:
@@ -77,100 +317,263 @@ public:
   void onMessage(WebsocketInputStreambuf *input) override;
   void onClose() override;
   void sendState();
+  void sendFrame(const StateFrame &frame);
+  void sendRamp(const char *frame, size_t length);
+  PeerLiveness &liveness() { return liveness_; }
+  void evict();
+
+private:
+  bool admit(Command command, const std::string &message);
+  void claimDriver();
+  void reply(const char *text, size_t length);
+  void uploadManeuver(const std::string &message);
+
+  bool admitted_ = false;
+  std::string clientId_;
+  PeerLiveness liveness_{wsPingIntervalMs, wsPingMissLimit};
 };
 
-SteeringWebsocket *wsClients[MAX_WS_CLIENTS] = {nullptr};
+// The driver is the session that last sent a control command. After it
+// disconnects, one WebSocket slot stays reserved for its client id for
+// driverReconnectGraceMs.
+SteeringWebsocket *driverSession = nullptr;
+std::string driverClientId;
+unsigned long driverLeftMs = 0;
 
-int mapTiltToAngle(float tilt) {
-  if (tilt < tiltMin) tilt = tiltMin;
-  if (tilt > tiltMax) tilt = tiltMax;
-  float norm = (tilt - tiltMin) / (tiltMax - tiltMin);
-  if (servodirection_inverse) norm = 1.0f - norm;
-  return servoMin + static_cast<int>(norm * (servoMax - servoMin));
-}
+bool admitHttp(HTTPResponse *res, const char *body = "");
 
+SteeringWebsocket *wsClients[MAX_WS_CLIENTS] = {nullptr};
+
+// The write* helpers only record the desired output; serviceActuators()
+// pushes it to the hardware once per PWM period.
 void writeServoAngle(int angle) {
-  if (angle < servoMin) angle = servoMin;
-  if (angle > servoMax) angle = servoMax;
-  const uint32_t maxDuty = (1u << servoResolution) - 1u;
-  const int pulseUs = servoPulseMinUs + (angle - servoMin) * (servoPulseMaxUs - servoPulseMinUs) / (servoMax - servoMin);
-  const uint32_t duty = (static_cast<uint64_t>(pulseUs) * maxDuty) / servoPeriodUs;
-  ledcWrite(servoChannel, duty);
+  servoActuator.request(servoDutyForAngle(angle), micros());
 }
 
 void writeMotorDuty(float duty) {
-  if (duty < 0.0f) duty = 0.0f;
-  if (duty > motorDutyMax) duty = motorDutyMax;
-  const uint32_t maxDuty = (1u << motorResolution) - 1u;
-  const uint32_t pwmValue = static_cast<uint32_t>(duty * maxDuty + 0.5f);
-  ledcWrite(motorChannel, pwmValue);
+  motorActuator.request(motorPwmForDuty(duty), micros());
+}
+
+void serviceActuators() {
+  const uint32_t now = micros();
+  if (servoActuator.service(now)) ledcWrite(servoChannel, servoActuator.value());
+  if (motorActuator.service(now)) ledcWrite(motorChannel, motorActuator.value());
+  if (headlightActuator.service(now)) digitalWrite(Vehicle::headlightPin, headlightActuator.value() ? HIGH : LOW);
 }
 
 void applyHandbrake() {
   gasPressed = false;
   motorDuty = 0.0f;
   writeMotorDuty(motorDuty);
-  lastBroadcastMotorDuty = motorDuty;
+  serviceActuators();
   broadcastState();
 }
 
 void setHeadlight(bool on) {
   headlightOn = on;
-  digitalWrite(headlightPin, on ? HIGH : LOW);
+  headlightActuator.request(on ? 1 : 0, micros());
   broadcastState();
 }
 
+void applyTilt(float tilt) {
+  currentTilt = tilt;
+  const int angle = mapTiltToAngle(tilt);
+  if (angle != currentAngle) {
+    writeServoAngle(angle);
+    currentAngle = angle;
+    LOG_DEBUG("Tilt: %.2f deg -> Angle: %d", currentTilt, currentAngle);
+  }
+}
+
+void setGas(bool on) {
+  if (gasPressed == on) return;
+  gasPressed = on;
+  broadcastRamp();
+}
+
+// Maneuver steps go through the same entry points as the phone's frames.
+struct ManeuverSink {
+  void tilt(float deg) {
+    applyTilt(deg);
+    broadcastState();
+  }
+  void gas(bool on) { setGas(on); }
+  void headlight(bool on) { setHeadlight(on); }
+  void handbrake() { applyHandbrake(); }
+};
+
+ManeuverSink maneuverSink;
+
+// Plays the stored maneuver, starting with the control tick of this loop
+// pass. Steering and gas frames from phones are ignored while it runs; a
+// handbrake frame aborts it.
+void startManeuver() {
+  maneuverPlayer.start(storedManeuver, currentTilt);
+  lastMotorUpdateMs = millis() - motorUpdateIntervalMs;
+  LOG_INFO("Maneuver started: %u steps, %u ms", storedManeuver.count, storedManeuver.durationMs);
+}
+
+void abortManeuver() {
+  if (!maneuverPlayer.running()) return;
+  maneuverPlayer.abort();
+  maneuversAborted.inc();
+  LOG_WARN("Maneuver aborted at %u ms", maneuverPlayer.elapsedMs());
+}
+
+void loadManeuver() {
+  maneuverStore.begin(maneuverNvsNamespace, false);
+  const String script = maneuverStore.getString(maneuverNvsKey, "");
+  if (script.length() == 0) return;
+  if (parseManeuver(script.c_str(), storedManeuver)) {
+    LOG_INFO("Maneuver loaded from NVS: %u steps, %u ms", storedManeuver.count, storedManeuver.durationMs);
+  } else {
+    storedManeuver.count = 0;
+    LOG_WARN("Maneuver in NVS does not parse, ignored");
+  }
+}
+
 void updateMotorControl() {
   const unsigned long now = millis();
-  const unsigned long elapsed = now - lastMotorUpdateMs;
+  unsigned long elapsed = now - lastMotorUpdateMs;
   if (elapsed < motorUpdateIntervalMs) return;
-  lastMotorUpdateMs = now;
 
-  const float ratePerMs = gasPressed ? motorAccelPerMs : -motorDecelPerMs;
-  float newDuty = motorDuty + ratePerMs * static_cast<float>(elapsed);
-  if (newDuty < 0.0f) newDuty = 0.0f;
-  if (newDuty > motorDutyMax) newDuty = motorDutyMax;
+  if (maneuverPlayer.running()) {
+    // Maneuvers run on a fixed tick grid: every tick is exactly one interval
+    // of script time and ramp, and a late tick is caught up instead of
+    // stretched, so each run issues the same commands on the same ticks.
+    elapsed = motorUpdateIntervalMs;
+    lastMotorUpdateMs += motorUpdateIntervalMs;
+    maneuverPlayer.tick(motorUpdateIntervalMs, maneuverSink);
+    if (!maneuverPlayer.running()) {
+      maneuversCompleted.inc();
+      LOG_INFO("Maneuver completed, %u ms", storedManeuver.durationMs);
+    }
+  } else {
+    lastMotorUpdateMs = now;
+  }
 
-  if (fabsf(newDuty - motorDuty) < 0.0001f) return;
+  const float newDuty = stepMotorDuty(motorDuty, gasPressed, elapsed);
+  const bool changed = fabsf(newDuty - motorDuty) >= 0.0001f;
   motorDuty = newDuty;
-  writeMotorDuty(motorDuty);
+  if (Vehicle::encoderPin >= 0) {
+    // With an encoder motorDuty is the throttle, a speed request; the speed
+    // loop picks the duty every tick, ramp moving or not. It runs on real
+    // time, so ticks caught up in the same millisecond reuse the last duty.
+    const unsigned long sampleMs = now - lastSpeedSampleMs;
+    if (sampleMs > 0) {
+      lastSpeedSampleMs = now;
+      const float speed = wheelSpeed.update(readEncoderPulses(), sampleMs);
+      wheelSpeedGauge.set(static_cast<uint32_t>(speed * 1000.0f));
+      writeMotorDuty(speedController.update(speedRequest(motorDuty), speed, sampleMs));
+      if (speedController.slipping()) wheelspinTicks.inc();
+    }
+  } else if (changed) {
+    writeMotorDuty(motorDuty);
+  }
+  if (!changed) return;
 
-  if (fabsf(motorDuty - lastBroadcastMotorDuty) >= 0.01f) {
-    lastBroadcastMotorDuty = motorDuty;
+  // Clients extrapolate the ramp from the ramp frame sent on the gas edge;
+  // only resync them occasionally and once the ramp settles.
+  if (rampResyncDue(motorDuty, now - lastMotorCorrectionMs)) {
+    lastMotorCorrectionMs = now;
     broadcastState();
   }
 }
 
+void reportStats() {
+  const unsigned long now = millis();
+  const unsigned long elapsed = now - lastStatsReportMs;
+  if (elapsed < statsReportIntervalMs) return;
+  lastStatsReportMs = now;
+
+  uint32_t framesTotal = 0;
+  for (const Counter *c : framesByCommand) framesTotal += c->read();
+  const uint32_t frames = framesTotal - lastReportFrames;
+  const uint32_t tiltFrames = framesTilt.read() - lastReportTiltFrames;
+  const uint32_t statesSent = stateFramesSent.read() - lastReportStatesSent;
+  lastReportFrames = framesTotal;
+  lastReportTiltFrames = framesTilt.read();
+  lastReportStatesSent = stateFramesSent.read();
+  if (frames == 0 && statesSent == 0 && loopStats.wakes() == 0) return;
+
+  const float seconds = static_cast<float>(elapsed) / 1000.0f;
+  LOG_INFO("WS rx: %.1f frames/s (tilt %.1f/s), tx: %.1f states/s", frames / seconds, tiltFrames / seconds,
+           statesSent / seconds);
+  LOG_INFO("Loop: idle %.1f%%, wakes %u (network %u), wake->apply avg %u us max %u us, CPU %u MHz",
+           loopStats.idlePercent(), loopStats.wakes(), loopStats.networkWakes(), loopStats.latencyAvgUs(),
+           loopStats.latencyMaxUs(), getCpuFrequencyMhz());
+  loopStats.reset();
+  LOG_INFO("PWM writes issued/skipped: servo %u/%u, motor %u/%u, headlight %u/%u", servoActuator.writesIssued(),
+           servoActuator.writesSkipped(), motorActuator.writesIssued(), motorActuator.writesSkipped(),
+           headlightActuator.writesIssued(), headlightActuator.writesSkipped());
+}
+
+RampParams currentRamp() {
+  return RampParams{motorDuty, gasPressed, Vehicle::motorAccelPerMs, Vehicle::motorDecelPerMs, Vehicle::motorDutyMax};
+}
+
+void broadcastRamp() {
+  char frame[kRampFrameMax];
+  const int length = formatRamp(frame, sizeof(frame), currentRamp());
+  lastMotorCorrectionMs = millis();
+  for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
+    if (wsClients[i] != nullptr) {
+      wsClients[i]->sendRamp(frame, length);
+    }
+  }
+}
+
+CarState currentState() {
+  return CarState{currentAngle, currentTilt, motorDuty, gasPressed, headlightOn};
+}
+
 void broadcastState() {
+  const StateFramePtr frame = stateFrames.get(currentState());
   for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
     if (wsClients[i] != nullptr) {
-      wsClients[i]->sendState();
+      wsClients[i]->sendFrame(*frame);
     }
   }
 }
 
 void setup() {
-  Serial.begin(115200);
-  Serial.println("Starting ESP32 Steering HTTPS server...");
+  // Outputs first: until LEDC owns the pins they float, and the ESC may read
+  // that as throttle.
+  pinMode(Vehicle::motorPwmPin, OUTPUT);
+  digitalWrite(Vehicle::motorPwmPin, LOW);
+  pinMode(Vehicle::headlightPin, OUTPUT);
+  headlightActuator.request(0, micros());
 
-  pinMode(headlightPin, OUTPUT);
-  digitalWrite(headlightPin, LOW);
+  ledcSetup(motorChannel, Vehicle::motorFreq, Vehicle::motorResolution);
+  motorActuator.anchor(micros());
+  ledcAttachPin(Vehicle::motorPwmPin, motorChannel);
+  writeMotorDuty(0.0f);
 
   ledcSetup(servoChannel, servoFreq, servoResolution);
-  ledcAttachPin(servoPin, servoChannel);
+  servoActuator.anchor(micros());
+  ledcAttachPin(Vehicle::servoPin, servoChannel);
   writeServoAngle(currentAngle);
+  serviceActuators();
+  bootPhases.mark(BootPhase::ActuatorsSafe, micros());
 
-  ledcSetup(motorChannel, motorFreq, motorResolution);
-  ledcAttachPin(motorPwmPin, motorChannel);
-  writeMotorDuty(0.0f);
+  Serial.begin(115200);
+  startLogTask();
+  bootPhases.mark(BootPhase::LogReady, micros());
+  LOG_INFO("Starting ESP32 Steering HTTPS server...");
+
+  if (Vehicle::encoderPin >= 0) setupEncoder();
   lastMotorUpdateMs = millis();
+  lastSpeedSampleMs = lastMotorUpdateMs;
+  loadManeuver();
 
-  Serial.print("Setting up AP: ");
-  Serial.println(ssid);
-  WiFi.softAP(ssid, password);
-  IPAddress ip = WiFi.softAPIP();
-  Serial.print("AP IP address: ");
-  Serial.println(ip);
+  // Bring up the network stack without an AP (STA mode is also what the
+  // channel scan needs), so the server can open its socket while the AP task
+  // scans and starts the AP.
+  WiFi.onEvent(onStationsChanged, ARDUINO_EVENT_WIFI_AP_STACONNECTED);
+  WiFi.onEvent(onStationsChanged, ARDUINO_EVENT_WIFI_AP_STADISCONNECTED);
+  WiFi.mode(WIFI_STA);
+  bootPhases.mark(BootPhase::NetStackUp, micros());
+  xTaskCreatePinnedToCore(startAccessPointTask, "ap", apTaskStackBytes, nullptr, apTaskPriority, nullptr, apTaskCore);
 
   ResourceNode *rootNode = new ResourceNode("/", "GET", &handleRoot);
   secureServer.registerNode(rootNode);
@@ -178,43 +581,363 @@ void setup() {
   WebsocketNode *wsNode = new WebsocketNode("/ws", &SteeringWebsocket::create);
   secureServer.registerNode(wsNode);
 
+  ResourceNode *metricsNode = new ResourceNode("/metrics", "GET", &handleMetrics);
+  secureServer.registerNode(metricsNode);
+
   ResourceNode *notFoundNode = new ResourceNode("", "GET", &handle404);
   secureServer.setDefaultNode(notFoundNode);
 
-  Serial.println("Starting HTTPS server...");
-  secureServer.start();
+  secureServer.start();  // parses the key and certificate
   if (secureServer.isRunning()) {
-    Serial.print("Server ready at https://");
-    Serial.println(ip);
+    bootPhases.mark(BootPhase::ServerUp, micros());
+    logTlsBufferConfig();
   } else {
-    Serial.println("Failed to start HTTPS server");
+    LOG_ERROR("Failed to start HTTPS server");
   }
 }
 
 void loop() {
+  const uint32_t awakeStart = micros();
+  if (!bootReported) reportBoot();
   secureServer.loop();
+  serviceWsLiveness();
   updateMotorControl();
-  delay(1);
+  serviceActuators();
+  updatePowerMode();
+  reportStats();
+  loopStats.recordAwake(micros() - awakeStart);
+  waitForWork();
+}
+
+void logDrainTask(void *) {
+  char line[160];
+  uint32_t reportedDrops = 0;
+  LogRecord record;
+  for (;;) {
+    while (asyncLog().pop(record)) {
+      Serial.write(reinterpret_cast<const uint8_t *>(line), formatLogRecord(record, line, sizeof(line)));
+    }
+    const uint32_t dropped = asyncLog().dropped();
+    if (dropped != reportedDrops) {
+      Serial.printf("(log: %u records dropped)\n", dropped - reportedDrops);
+      reportedDrops = dropped;
+    }
+    vTaskDelay(pdMS_TO_TICKS(logDrainIntervalMs));
+  }
+}
+
+void startLogTask() {
+  asyncLog().setClock([] { return static_cast<uint32_t>(micros()); });
+  xTaskCreatePinnedToCore(logDrainTask, "log", logTaskStackBytes, nullptr, logTaskPriority, &logTask, logTaskCore);
+}
+
+void setupEncoder() {
+  pcnt_config_t config = {};
+  config.pulse_gpio_num = Vehicle::encoderPin;
+  config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+  config.channel = PCNT_CHANNEL_0;
+  config.unit = encoderUnit;
+  config.pos_mode = PCNT_COUNT_INC;
+  config.neg_mode = PCNT_COUNT_DIS;
+  config.lctrl_mode = PCNT_MODE_KEEP;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  config.counter_h_lim = encoderCountLimit;
+  config.counter_l_lim = 0;
+  pcnt_unit_config(&config);
+  pcnt_set_filter_value(encoderUnit, Vehicle::encoderGlitchFilter);
+  pcnt_filter_enable(encoderUnit);
+  pcnt_counter_pause(encoderUnit);
+  pcnt_counter_clear(encoderUnit);
+  pcnt_counter_resume(encoderUnit);
+  lastEncoderCount = 0;
+  LOG_INFO("Wheel encoder on GPIO %d, closed-loop speed up to %.1f m/s", Vehicle::encoderPin, Vehicle::speedMaxMps);
+}
+
+// Pulses since the previous call. The counter is never cleared, so no edge
+// is lost between a read and a clear; it only wraps at encoderCountLimit.
+uint32_t readEncoderPulses() {
+  int16_t count = 0;
+  pcnt_get_counter_value(encoderUnit, &count);
+  const int32_t delta = count >= lastEncoderCount ? count - lastEncoderCount
+                                                  : count + encoderCountLimit - lastEncoderCount;
+  lastEncoderCount = count;
+  return static_cast<uint32_t>(delta);
+}
+
+// Blocks until a lwIP socket (listener or client connection) is readable or
+// `timeoutUs` elapses. Returns true if a socket woke us.
+bool waitForSockets(uint32_t timeoutUs) {
+  fd_set readSet;
+  FD_ZERO(&readSet);
+  int maxFd = -1;
+  for (int fd = LWIP_SOCKET_OFFSET; fd < LWIP_SOCKET_OFFSET + CONFIG_LWIP_MAX_SOCKETS; ++fd) {
+    if (fcntl(fd, F_GETFL, 0) < 0) continue;  // not an open socket
+    FD_SET(fd, &readSet);
+    maxFd = fd;
+  }
+  if (maxFd < 0) {
+    delay((timeoutUs + 999) / 1000);
+    return false;
+  }
+  timeval timeout;
+  timeout.tv_sec = timeoutUs / 1000000;
+  timeout.tv_usec = timeoutUs % 1000000;
+  return select(maxFd + 1, &readSet, nullptr, nullptr, &timeout) > 0;
+}
+
+// Sleeps until the next thing loop() has to do: a readable socket, the next
+// motor ramp tick or a pending actuator write.
+void waitForWork() {
+  const uint32_t now = micros();
+  uint32_t timeoutUs = stationsPresent ? activeMaxWaitUs : idleMaxWaitUs;
+
+  // mbedTLS may hold decrypted bytes the socket no longer reports, so keep
+  // polling briefly after traffic instead of blocking straight away.
+  if (now - lastNetActivityUs < netBurstUs) timeoutUs = 0;
+
+  if (gasPressed || motorDuty > 0.0f || maneuverPlayer.running()) {
+    const uint32_t sinceTickUs = (millis() - lastMotorUpdateMs) * 1000u;
+    const uint32_t tickUs = motorUpdateIntervalMs * 1000u;
+    timeoutUs = std::min<uint32_t>(timeoutUs, sinceTickUs >= tickUs ? 0u : tickUs - sinceTickUs);
+  }
+  timeoutUs = std::min<uint32_t>(timeoutUs, servoActuator.usUntilDue(now));
+  timeoutUs = std::min<uint32_t>(timeoutUs, motorActuator.usUntilDue(now));
+  timeoutUs = std::min<uint32_t>(timeoutUs, headlightActuator.usUntilDue(now));
+  for (SteeringWebsocket *client : wsClients) {
+    if (client != nullptr) timeoutUs = std::min<uint32_t>(timeoutUs, client->liveness().msUntilDue(millis()) * 1000u);
+  }
+
+  const bool byNetwork = timeoutUs == 0 ? false : waitForSockets(timeoutUs);
+  const uint32_t woke = micros();
+  if (timeoutUs != 0) {
+    loopStats.recordBlocked(woke - now);
+    loopStats.recordWake(byNetwork);
+  }
+  if (byNetwork) {
+    lastNetActivityUs = woke;
+    netWakeUs = woke;
+    netWakePending = true;
+  }
+}
+
+void serviceWsLiveness() {
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
+    SteeringWebsocket *client = wsClients[i];
+    if (client == nullptr) continue;
+    switch (client->liveness().poll(now)) {
+      case PeerLiveness::Action::None:
+        break;
+      case PeerLiveness::Action::Ping:
+        client->send(reinterpret_cast<uint8_t *>(const_cast<char *>(pingFrame)), sizeof(pingFrame) - 1,
+                     WebsocketHandler::SEND_TYPE_TEXT);
+        wsPingsSent.inc();
+        wsBytesSent.inc(sizeof(pingFrame) - 1);
+        break;
+      case PeerLiveness::Action::Evict:
+        client->evict();
+        break;
+    }
+  }
+}
+
+// Called when a control command reaches the actuators; closes the
+// wake-to-apply measurement for the socket wake that delivered it.
+void noteCommandApplied() {
+  if (bootPhases.mark(BootPhase::FirstControl, micros())) {
+    LOG_INFO("Boot: first control frame applied at %u.%03u ms", bootPhases.atUs(BootPhase::FirstControl) / 1000,
+             bootPhases.atUs(BootPhase::FirstControl) % 1000);
+  }
+  if (!netWakePending) return;
+  netWakePending = false;
+  loopStats.recordWakeLatency(micros() - netWakeUs);
+}
+
+void onStationsChanged(WiFiEvent_t) {
+  stationsPresent = WiFi.softAPgetStationNum() > 0;
+}
+
+// Full clock while someone is connected, lowest Wi-Fi-safe clock otherwise.
+// The soft AP has to keep beaconing, so the chip cannot enter light sleep
+// while it is up; blocking in select() plus the reduced clock is the idle state.
+void updatePowerMode() {
+  const uint32_t wantMhz = stationsPresent ? activeCpuMhz : idleCpuMhz;
+  if (getCpuFrequencyMhz() != wantMhz) setCpuFrequencyMhz(wantMhz);
+}
+
+// Runs on core 0: picks the channel, starts the AP and marks those boot phases.
+void startAccessPointTask(void *) {
+  const uint8_t channel = selectApChannel();
+  bootPhases.mark(BootPhase::ChannelPicked, micros());
+  WiFi.softAP(ssid, password, channel);
+  applyRadioProfile();
+  bootPhases.mark(BootPhase::ApUp, micros());
+  const IPAddress ip = WiFi.softAPIP();
+  LOG_INFO("AP %s on channel %u, https://%u.%u.%u.%u/", ssid, channel, ip[0], ip[1], ip[2], ip[3]);
+  apTaskStackFreeMin = uxTaskGetStackHighWaterMark(nullptr);
+  vTaskDelete(nullptr);
+}
+
+// Once the AP and the server are both up, prints when each boot phase ended
+// (time since app start) and how long the phase itself took.
+void reportBoot() {
+  if (!bootPhases.reached(BootPhase::ApUp) || !bootPhases.reached(BootPhase::ServerUp)) return;
+  bootReported = true;
+  bootPhases.mark(BootPhase::Ready, micros());
+  for (uint8_t i = 0; i < static_cast<uint8_t>(BootPhase::FirstControl); ++i) {
+    const BootPhase phase = static_cast<BootPhase>(i);
+    const uint32_t atUs = bootPhases.atUs(phase);
+    LOG_INFO("Boot: %-14s at %5u.%03u ms (+%u us)", bootPhaseName(phase), atUs / 1000, atUs % 1000,
+             bootPhases.durationUs(phase));
+  }
+}
+
+// Scans for nearby APs and returns the least congested channel (or the
+// fixed apChannel). Leaves the radio in plain AP mode.
+uint8_t selectApChannel() {
+  if (apChannel != 0) {
+    WiFi.mode(WIFI_AP);
+    return apChannel;
+  }
+
+  WiFi.mode(WIFI_STA);  // scanning needs the station interface
+  const int16_t found = WiFi.scanNetworks(false, true, false, apScanMsPerChannel);
+  ScanResult aps[maxScanResults];
+  size_t count = 0;
+  for (int16_t i = 0; i < found && count < maxScanResults; ++i) {
+    aps[count++] = ScanResult{static_cast<uint8_t>(WiFi.channel(i)), static_cast<int8_t>(WiFi.RSSI(i))};
+  }
+  WiFi.scanDelete();
+  WiFi.mode(WIFI_AP);
+
+  const uint8_t channel = pickQuietestChannel(aps, count);
+  // One write, so the line is not interleaved with the log task's output.
+  char line[160];
+  int len = snprintf(line, sizeof(line), "Wi-Fi scan: %d APs. Congestion by channel:", found);
+  for (uint8_t ch = kFirstApChannel; ch <= kLastApChannel && len > 0 && len < static_cast<int>(sizeof(line)); ++ch) {
+    len += snprintf(line + len, sizeof(line) - len, " %u=%.1f", ch, channelCongestion(ch, aps, count));
+  }
+  Serial.println(line);
+  return channel;
+}
+
+// Low-latency AP settings: no modem power save, 20 MHz channel (HT40 would
+// occupy a second, possibly busy channel) and full TX power. The beacon
+// interval stays at ESP-IDF's default of 100 TU, which is also its minimum.
+void applyRadioProfile() {
+  WiFi.setSleep(false);
+  esp_wifi_set_bandwidth(WIFI_IF_AP, WIFI_BW_HT20);
+  WiFi.setTxPower(WIFI_POWER_19_5dBm);
 }
 
 void handle404(HTTPRequest *req, HTTPResponse *res) {
+  static const char body[] =
+      "<!DOCTYPE html>\n"
+      "<html><head><title>404 Not Found</title></head>\n"
+      "<body><h1>404 Not Found</h1></body></html>\n";
   req->discardRequestBody();
   res->setStatusCode(404);
   res->setStatusText("Not Found");
   res->setHeader("Content-Type", "text/html");
-  res->println("<!DOCTYPE html>");
-  res->println("<html><head><title>404 Not Found</title></head>");
-  res->println("<body><h1>404 Not Found</h1></body></html>");
+  // An explicit length lets the connection be kept alive for the next request.
+  res->setHeader("Content-Length", std::to_string(sizeof(body) - 1));
+  res->print(body);
+  httpBytesSent.inc(sizeof(body) - 1);
 }
 
+// Page-load budget check. Replies 503 with `body` and closes when the HTTP
+// pool is full.
+bool admitHttp(HTTPResponse *res, const char *body) {
+  if (admitHttpRequest(secureServer.openConnections(), countWsClients(), MAX_HTTP_CONNECTIONS)) return true;
+  rejectedHttp.inc();
+  const size_t length = strlen(body);
+  res->setStatusCode(503);
+  res->setStatusText("Service Unavailable");
+  res->setHeader("Retry-After", "1");
+  res->setHeader("Connection", "close");
+  res->setHeader("Content-Length", std::to_string(length));
+  if (length > 0) {
+    res->setHeader("Content-Type", "text/html; charset=utf-8");
+    res->print(body);
+    httpBytesSent.inc(length);
+  }
+  return false;
+}
+
+// Browsers ignore Retry-After, so a busy page reloads itself instead of
+// leaving the phone on a blank screen.
+const char busyPage[] =
+    "<!DOCTYPE html><html><head><meta http-equiv=\"refresh\" content=\"1\"><title>Busy</title></head>"
+    "<body>Car busy, retrying&hellip;</body></html>";
+
+// The page opens its WebSocket on a new connection, so the one that loaded it
+// would only sit idle in an HTTP slot until the keep-alive timeout. Close it.
 void handleRoot(HTTPRequest *req, HTTPResponse *res) {
   req->discardRequestBody();
-  res->setHeader("Content-Type", "text/html");
-  res->println(WEB_UI_HTML);
+  if (!admitHttp(res, busyPage)) return;
+  res->setHeader("Connection", "close");
+  res->setHeader("ETag", WEB_UI_ETAG);
+  res->setHeader("Cache-Control", "no-cache");
+  if (req->getHeader("If-None-Match") == WEB_UI_ETAG) {
+    res->setStatusCode(304);
+    res->setStatusText("Not Modified");
+    return;
+  }
+  res->setHeader("Content-Type", "text/html; charset=utf-8");
+  res->setHeader("Content-Encoding", "gzip");
+  res->setHeader("Content-Length", std::to_string(WEB_UI_GZ_LEN));
+  res->write(WEB_UI_GZ, WEB_UI_GZ_LEN);
+  httpBytesSent.inc(WEB_UI_GZ_LEN);
+}
+
+void handleMetrics(HTTPRequest *req, HTTPResponse *res) {
+  req->discardRequestBody();
+  if (!admitHttp(res)) return;
+  std::string body;
+  body.reserve(2048);
+  renderPrometheus(body);
+  res->setHeader("Content-Type", "text/plain; version=0.0.4");
+  res->setHeader("Content-Length", std::to_string(body.size()));
+  res->write(reinterpret_cast<const uint8_t *>(body.data()), body.size());
+  httpBytesSent.inc(body.size());
+}
+
+uint32_t tlsCapacity() {
+  return connectionHeap.capacity(secureServer.openConnections(), ESP.getFreeHeap(), tlsHeapReserveBytes);
+}
+
+// The record buffer sizes come from the framework's mbedTLS build (sdkconfig),
+// not from this sketch; log them so heap figures can be read against them.
+void logTlsBufferConfig() {
+#if defined(CONFIG_MBEDTLS_ASYMMETRIC_CONTENT_LEN)
+  const unsigned inBytes = CONFIG_MBEDTLS_SSL_IN_CONTENT_LEN;
+  const unsigned outBytes = CONFIG_MBEDTLS_SSL_OUT_CONTENT_LEN;
+#elif defined(CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN)
+  const unsigned inBytes = CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN;
+  const unsigned outBytes = CONFIG_MBEDTLS_SSL_MAX_CONTENT_LEN;
+#else
+  const unsigned inBytes = 16384;
+  const unsigned outBytes = 16384;
+#endif
+#if defined(CONFIG_MBEDTLS_DYNAMIC_BUFFER)
+  const char *dynamic = "on";
+#else
+  const char *dynamic = "off";
+#endif
+  LOG_INFO("TLS record buffers: in %u, out %u bytes, dynamic buffers %s", inBytes, outBytes, dynamic);
+}
+
+uint32_t countWsClients() {
+  uint32_t count = 0;
+  for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
+    if (wsClients[i] != nullptr) ++count;
+  }
+  return count;
 }
 
 WebsocketHandler *SteeringWebsocket::create() {
   SteeringWebsocket *handler = new SteeringWebsocket();
+  handler->liveness_.heard(millis());
   for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
     if (wsClients[i] == nullptr) {
       wsClients[i] = handler;
@@ -230,69 +953,198 @@ void SteeringWebsocket::onClose() {
       wsClients[i] = nullptr;
     }
   }
+  if (driverSession == this) {
+    driverSession = nullptr;
+    driverLeftMs = millis();
+  }
+}
+
+// Decides on the first frame whether this session may stay. Sessions that
+// found no free slot in create(), or that would take the slot held for a
+// reconnecting driver, get {"error":"busy"} and are closed.
+bool SteeringWebsocket::admit(Command command, const std::string &message) {
+  if (command == Command::Hello) clientId_ = message.substr(kHelloPrefixLen);
+
+  bool registered = false;
+  uint8_t others = 0;
+  for (uint8_t i = 0; i < MAX_WS_CLIENTS; ++i) {
+    if (wsClients[i] == this) {
+      registered = true;
+    } else if (wsClients[i] != nullptr) {
+      ++others;
+    }
+  }
+  const bool isDriver = !clientId_.empty() && clientId_ == driverClientId;
+  const bool driverSlotHeld =
+      driverSession == nullptr && !driverClientId.empty() && millis() - driverLeftMs < driverReconnectGraceMs;
+
+  if (!registered || !admitWsSession(others, MAX_WS_CLIENTS, isDriver, driverSlotHeld)) {
+    rejectedWs.inc();
+    send(busyReply, WebsocketHandler::SEND_TYPE_TEXT);
+    wsBytesSent.inc(sizeof(busyReply) - 1);
+    onClose();
+    close();
+    return false;
+  }
+
+  admitted_ = true;
+  if (isDriver) driverSession = this;
+  return true;
+}
+
+void SteeringWebsocket::claimDriver() {
+  if (driverSession == this) return;
+  driverSession = this;
+  driverClientId = clientId_;
 }
 
 void SteeringWebsocket::sendState() {
-  char payload[64];
-  snprintf(payload, sizeof(payload), "{\"angle\":%d,\"tilt\":%.2f,\"motorDuty\":%.3f,\"gas\":%s,\"headlight\":%s}", currentAngle, currentTilt, motorDuty, gasPressed ? "true" : "false", headlightOn ? "true" : "false");
-  send(std::string(payload), WebsocketHandler::SEND_TYPE_TEXT);
+  const StateFramePtr frame = stateFrames.get(currentState());
+  sendFrame(*frame);
+}
+
+void SteeringWebsocket::sendFrame(const StateFrame &frame) {
+  if (liveness_.suspect(millis())) return;
+  send(reinterpret_cast<uint8_t *>(const_cast<char *>(frame.data)), frame.length, WebsocketHandler::SEND_TYPE_TEXT);
+  stateFramesSent.inc();
+  wsBytesSent.inc(frame.length);
+}
+
+void SteeringWebsocket::sendRamp(const char *frame, size_t length) {
+  if (liveness_.suspect(millis())) return;
+  send(reinterpret_cast<uint8_t *>(const_cast<char *>(frame)), length, WebsocketHandler::SEND_TYPE_TEXT);
+  rampFramesSent.inc();
+  wsBytesSent.inc(length);
+}
+
+void SteeringWebsocket::reply(const char *text, size_t length) {
+  send(reinterpret_cast<uint8_t *>(const_cast<char *>(text)), length, WebsocketHandler::SEND_TYPE_TEXT);
+  wsBytesSent.inc(length);
+}
+
+// Parses and stores a maneuver script, in RAM for maneuver_run and in NVS
+// for the next boot, and answers with its step count and length. Not while
+// one is playing: the player reads the stored steps.
+void SteeringWebsocket::uploadManeuver(const std::string &message) {
+  if (maneuverPlayer.running()) {
+    reply(maneuverRunningReply, sizeof(maneuverRunningReply) - 1);
+    return;
+  }
+  static Maneuver parsed;
+  const char *script = message.c_str() + kManeuverPrefixLen;
+  if (message.size() - kManeuverPrefixLen > kManeuverMaxText || !parseManeuver(script, parsed)) {
+    parseErrors.inc();
+    reply(invalidInputReply, sizeof(invalidInputReply) - 1);
+    return;
+  }
+  storedManeuver = parsed;
+  maneuverStore.putString(maneuverNvsKey, script);
+  LOG_INFO("Maneuver stored: %u steps, %u ms", storedManeuver.count, storedManeuver.durationMs);
+
+  char frame[48];
+  char *p = frame;
+  p = appendLiteral(p, "{\"maneuver\":{\"steps\":");
+  p = appendUInt(p, storedManeuver.count);
+  p = appendLiteral(p, ",\"ms\":");
+  p = appendUInt(p, storedManeuver.durationMs);
+  p = appendLiteral(p, "}}");
+  reply(frame, p - frame);
+}
+
+// Frees the slot (and the driver seat) now; the library then closes the
+// connection and releases its TLS context on its next pass.
+void SteeringWebsocket::evict() {
+  LOG_WARN("WS client evicted after %u ms without a frame", liveness_.silentMs(millis()));
+  wsEvictions.inc();
+  onClose();
+  close();
 }
 
 void SteeringWebsocket::onMessage(WebsocketInputStreambuf *input) {
+  liveness_.heard(millis());
   std::ostringstream ss;
   ss << input;
   std::string message = ss.str();
 
-  if (message == "sync") {
-    sendState();
-    return;
-  }
+  float tilt = 0.0f;
+  const Command command = parseCommand(message, tilt);
+  framesByCommand[static_cast<uint8_t>(command)]->inc();
+  if (!admitted_ && !admit(command, message)) return;
 
-  if (message == "gas_on") {
-    if (!gasPressed) {
-      gasPressed = true;
-      broadcastState();
-    }
-    return;
-  }
+  switch (command) {
+    case Command::Hello:
+    case Command::Pong:
+      return;
 
-  if (message == "gas_off") {
-    if (gasPressed) {
-      gasPressed = false;
-      broadcastState();
+    case Command::Sync: {
+      sendState();
+      char ramp[kRampFrameMax];
+      sendRamp(ramp, formatRamp(ramp, sizeof(ramp), currentRamp()));
+      return;
     }
-    return;
-  }
 
-  if (message == "handbrake") {
-    applyHandbrake();
-    return;
-  }
+    case Command::GasOn:
+      claimDriver();
+      noteCommandApplied();
+      if (!maneuverPlayer.running()) setGas(true);
+      return;
 
-  if (message == "headlight_on") {
-    setHeadlight(true);
-    return;
-  }
+    case Command::GasOff:
+      claimDriver();
+      noteCommandApplied();
+      if (!maneuverPlayer.running()) setGas(false);
+      return;
 
-  if (message == "headlight_off") {
-    setHeadlight(false);
-    return;
-  }
+    case Command::Handbrake:
+      claimDriver();
+      abortManeuver();
+      applyHandbrake();
+      noteCommandApplied();
+      return;
 
-  char *endPtr = nullptr;
-  float tilt = strtof(message.c_str(), &endPtr);
-  if (endPtr == message.c_str() || !isfinite(tilt)) {
-    send("{\"error\":\"invalid_input\"}", WebsocketHandler::SEND_TYPE_TEXT);
-    return;
-  }
+    case Command::HeadlightOn:
+      claimDriver();
+      setHeadlight(true);
+      noteCommandApplied();
+      return;
 
-  currentTilt = tilt;
-  int angle = mapTiltToAngle(tilt);
-  if (angle != currentAngle) {
-    writeServoAngle(angle);
-    currentAngle = angle;
-    Serial.printf("Tilt: %.2f deg -> Angle: %d\n", currentTilt, currentAngle);
+    case Command::HeadlightOff:
+      claimDriver();
+      setHeadlight(false);
+      noteCommandApplied();
+      return;
+
+    case Command::Invalid:
+      parseErrors.inc();
+      send(invalidInputReply, WebsocketHandler::SEND_TYPE_TEXT);
+      wsBytesSent.inc(sizeof(invalidInputReply) - 1);
+      return;
+
+    case Command::Maneuver:
+      claimDriver();
+      uploadManeuver(message);
+      return;
+
+    case Command::ManeuverRun:
+      claimDriver();
+      if (maneuverPlayer.running()) {
+        reply(maneuverRunningReply, sizeof(maneuverRunningReply) - 1);
+      } else if (storedManeuver.count == 0) {
+        reply(noManeuverReply, sizeof(noManeuverReply) - 1);
+      } else {
+        startManeuver();
+        noteCommandApplied();
+      }
+      return;
+
+    case Command::Tilt:
+      claimDriver();
+      if (maneuverPlayer.running()) return;
+      break;
   }
 
+  applyTilt(tilt);
+  noteCommandApplied();
+
   broadcastState();
 }
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Minimal micro-benchmark harness for the native build.
+//
+// Each benchmark is calibrated until one batch takes at least kMinBatchNs, then
+// timed kRepeats times; the fastest batch is reported to filter scheduler noise.
+
+namespace bench {
+
+constexpr uint64_t kMinBatchNs = 20ull * 1000ull * 1000ull;
+constexpr int kRepeats = 5;
+
+struct Result {
+  const char *name;
+  uint64_t iterations;
+  double nsPerOp;
+};
+
+inline std::vector<Result> &results() {
+  static std::vector<Result> all;
+  return all;
+}
+
+template <typename T>
+inline void doNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <typename Fn>
+inline uint64_t timeBatch(Fn &fn, uint64_t iterations) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; ++i) fn(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+// `fn` is called with the iteration index so benchmarks can walk an input table.
+template <typename Fn>
+inline const Result &run(const char *name, Fn fn) {
+  uint64_t iterations = 1;
+  while (timeBatch(fn, iterations) < kMinBatchNs) iterations *= 2;
+
+  uint64_t best = UINT64_MAX;
+  for (int r = 0; r < kRepeats; ++r) {
+    const uint64_t ns = timeBatch(fn, iterations);
+    if (ns < best) best = ns;
+  }
+  results().push_back(Result{name, iterations, static_cast<double>(best) / static_cast<double>(iterations)});
+  return results().back();
+}
+
+// Stable, whitespace-separated format: one header line, then one line per benchmark.
+inline bool writeReport(const char *path) {
+  FILE *out = fopen(path, "w");
+  if (out == nullptr) return false;
+  fprintf(out, "%-32s %12s %12s\n", "benchmark", "iterations", "ns/op");
+  for (const Result &r : results()) {
+    fprintf(out, "%-32s %12llu %12.2f\n", r.name, static_cast<unsigned long long>(r.iterations), r.nsPerOp);
+  }
+  fclose(out);
+  return true;
+}
+
+}  // namespace bench
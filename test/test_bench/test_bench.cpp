@@ -0,0 +1,313 @@
+// Micro-benchmarks for the control and protocol hot paths.
+//
+//   pio test -e native -f test_bench
+//
+// Results are written to bench_output.txt in the project directory. This suite
+// only times; the values these functions compute are checked in test_unit.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "actuator.h"
+#include "async_log.h"
+#include "bench.h"
+#include "channel_select.h"
+#include "liveness.h"
+#include "maneuver.h"
+#include "metrics.h"
+#include "control.h"
+#include "protocol.h"
+
+namespace {
+
+constexpr size_t kTableSize = 256;  // power of two so `i & mask` walks the table
+
+float tiltTable[kTableSize];
+int angleTable[kTableSize];
+float dutyTable[kTableSize];
+
+void fillTables() {
+  for (size_t i = 0; i < kTableSize; ++i) {
+    tiltTable[i] = -60.0f + 120.0f * static_cast<float>(i) / kTableSize;
+    angleTable[i] = Vehicle::servoMin + static_cast<int>(i % (Vehicle::servoMax - Vehicle::servoMin + 1));
+    dutyTable[i] = static_cast<float>(i) / (kTableSize - 1);
+  }
+}
+
+// Mirrors updateMotorControl() without the timer and ledcWrite().
+struct MotorTickModel {
+  float duty = 0.0f;
+  bool gas = false;
+  uint32_t nowMs = 0;
+  uint32_t lastCorrectionMs = 0;
+  uint32_t pwm = 0;
+  uint32_t broadcasts = 0;
+
+  void setGas(bool on) {
+    if (on == gas) return;
+    gas = on;
+    lastCorrectionMs = nowMs;
+    ++broadcasts;  // ramp frame on the edge
+  }
+
+  void tick(bool gasHeld) {
+    setGas(gasHeld);
+    nowMs += motorUpdateIntervalMs;
+    const float newDuty = stepMotorDuty(duty, gas, motorUpdateIntervalMs);
+    if (fabsf(newDuty - duty) < 0.0001f) return;
+    duty = newDuty;
+    pwm = motorPwmForDuty(duty);
+    if (rampResyncDue(duty, nowMs - lastCorrectionMs)) {
+      lastCorrectionMs = nowMs;
+      ++broadcasts;
+    }
+  }
+};
+
+// Mirrors the frame extraction at the top of SteeringWebsocket::onMessage().
+Command readAndParse(std::stringbuf &frame, float &tilt) {
+  frame.pubseekpos(0, std::ios_base::in);
+  std::ostringstream ss;
+  ss << &frame;
+  return parseCommand(ss.str(), tilt);
+}
+
+void benchParse(const char *name, const char *frame) {
+  const std::string message(frame);
+  float tilt = 0.0f;
+  bench::run(name, [&](uint64_t) {
+    Command c = parseCommand(message, tilt);
+    bench::doNotOptimize(c);
+    bench::doNotOptimize(tilt);
+  });
+}
+
+Counter benchFramesA("bench_frames_total", "command=\"a\"", "Frames by command");
+Counter benchFramesB("bench_frames_total", "command=\"b\"", "");
+CallbackMetric benchHeap("bench_free_bytes", "", "Free bytes", MetricType::Gauge, [] { return 4096u; });
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void bench_map_tilt_to_angle() {
+  bench::run("mapTiltToAngle", [](uint64_t i) {
+    int angle = mapTiltToAngle(tiltTable[i & (kTableSize - 1)]);
+    bench::doNotOptimize(angle);
+  });
+}
+
+void bench_servo_duty() {
+  bench::run("servoDutyForAngle", [](uint64_t i) {
+    uint32_t duty = servoDutyForAngle(angleTable[i & (kTableSize - 1)]);
+    bench::doNotOptimize(duty);
+  });
+}
+
+void bench_motor_pwm() {
+  bench::run("motorPwmForDuty", [](uint64_t i) {
+    uint32_t pwm = motorPwmForDuty(dutyTable[i & (kTableSize - 1)]);
+    bench::doNotOptimize(pwm);
+  });
+}
+
+void bench_motor_tick() {
+  MotorTickModel ramp;
+  // Alternate 1 s of gas and 1 s of coasting so every tick does real work.
+  bench::run("updateMotorControl_tick", [&](uint64_t i) {
+    ramp.tick(((i / 50) & 1) == 0);
+    bench::doNotOptimize(ramp.pwm);
+  });
+}
+
+void bench_parse_commands() {
+  benchParse("parse_sync", "sync");
+  benchParse("parse_gas_on", "gas_on");
+  benchParse("parse_gas_off", "gas_off");
+  benchParse("parse_handbrake", "handbrake");
+  benchParse("parse_headlight_on", "headlight_on");
+  benchParse("parse_headlight_off", "headlight_off");
+  benchParse("parse_hello", "hello:k3j9x0");
+  benchParse("parse_pong", "pong");
+  benchParse("parse_maneuver", "maneuver:g1 w3000 g0");
+  benchParse("parse_maneuver_run", "maneuver_run");
+  benchParse("parse_tilt", "-12.34");
+  benchParse("parse_invalid", "steer_left");
+
+  std::stringbuf frame("-12.34");
+  float tilt = 0.0f;
+  bench::run("onMessage_read_parse_tilt", [&](uint64_t) {
+    Command c = readAndParse(frame, tilt);
+    bench::doNotOptimize(c);
+  });
+}
+
+// The snprintf formatter that formatState() replaced, timed for comparison.
+int formatStateSnprintf(char *out, size_t size, const CarState &state) {
+  return snprintf(out, size, "{\"angle\":%d,\"tilt\":%.2f,\"motorDuty\":%.3f,\"gas\":%s,\"headlight\":%s}",
+                  state.angle, state.tilt, state.motorDuty, state.gas ? "true" : "false",
+                  state.headlight ? "true" : "false");
+}
+
+void bench_format_state() {
+  char payload[kStateFrameMax];
+  const CarState typical{73, -12.34f, 0.456f, true, false};
+  bench::run("formatState_typical", [&](uint64_t) {
+    int n = formatState(payload, sizeof(payload), typical);
+    bench::doNotOptimize(n);
+    bench::doNotOptimize(payload[0]);
+  });
+
+  const CarState widest{Vehicle::servoMax, Vehicle::tiltMin, Vehicle::motorDutyMax, false, false};
+  bench::run("formatState_widest", [&](uint64_t) {
+    int n = formatState(payload, sizeof(payload), widest);
+    bench::doNotOptimize(n);
+    bench::doNotOptimize(payload[0]);
+  });
+
+  bench::run("formatState_snprintf_typical", [&](uint64_t) {
+    int n = formatStateSnprintf(payload, sizeof(payload), typical);
+    bench::doNotOptimize(n);
+    bench::doNotOptimize(payload[0]);
+  });
+}
+
+// Mirrors broadcastState(): one cache lookup, then the same frame copied to
+// every client's socket buffer. The state changes on every call, so each
+// iteration pays for exactly one encode.
+template <size_t Clients>
+void benchFanout(const char *name) {
+  StateFrameCache cache;
+  char sockets[Clients][kStateFrameMax];
+  CarState state{90, 0.0f, 0.0f, true, false};
+  bench::run(name, [&](uint64_t i) {
+    state.motorDuty = static_cast<float>(i & 1023) / 1023.0f;
+    const StateFramePtr frame = cache.get(state);
+    for (size_t c = 0; c < Clients; ++c) {
+      memcpy(sockets[c], frame->data, frame->length);
+      bench::doNotOptimize(sockets[c][0]);
+    }
+  });
+}
+
+void bench_broadcast_fanout() {
+  benchFanout<1>("broadcastState_1_client");
+  benchFanout<4>("broadcastState_4_clients");
+  benchFanout<8>("broadcastState_8_clients");
+}
+
+void bench_actuator() {
+  Actuator motor(motorPeriodUs, motorPeriodUs);
+  uint32_t now = 0;
+  bench::run("actuator_request_service", [&](uint64_t i) {
+    now += 7;
+    motor.request(static_cast<uint32_t>(i >> 4) & 4095u, now);
+    bool write = motor.service(now);
+    bench::doNotOptimize(write);
+  });
+}
+
+void bench_metrics() {
+  std::string out;
+  bench::run("metrics_counter_inc", [](uint64_t) {
+    benchFramesA.inc();
+  });
+  bench::run("metrics_render", [&](uint64_t) {
+    out.clear();
+    renderPrometheus(out);
+    bench::doNotOptimize(out.data());
+  });
+}
+
+// Scan recorded at a club meet: channel 1 and 6 crowded, a loud AP on 11.
+const ScanResult recordedScan[] = {
+    {1, -42}, {1, -67}, {1, -71}, {1, -80}, {2, -77}, {3, -85}, {6, -48}, {6, -55},
+    {6, -63}, {6, -70}, {6, -88}, {7, -81}, {11, -39}, {11, -90}, {9, -84}, {4, -91},
+};
+
+void bench_channel_select() {
+  const size_t count = sizeof(recordedScan) / sizeof(recordedScan[0]);
+  bench::run("pickQuietestChannel_16_aps", [&](uint64_t) {
+    uint8_t ch = pickQuietestChannel(recordedScan, count);
+    bench::doNotOptimize(ch);
+  });
+}
+
+uint32_t fakeClockUs() { return 12345678u; }
+
+void bench_async_log() {
+  AsyncLog log;
+  log.setClock(&fakeClockUs);
+  LogRecord record;
+  char line[160];
+  const int angle = 97;
+  bench::run("log_write_pop", [&](uint64_t i) {
+    log.write(LOG_LEVEL_DEBUG, "Tilt: %.2f deg -> Angle: %d", tiltTable[i & (kTableSize - 1)], angle);
+    log.pop(record);
+    bench::doNotOptimize(record);
+  });
+  bench::run("log_format_record", [&](uint64_t) {
+    bench::doNotOptimize(formatLogRecord(record, line, sizeof(line)));
+  });
+  bench::run("snprintf_tilt_line", [&](uint64_t i) {
+    bench::doNotOptimize(
+        snprintf(line, sizeof(line), "Tilt: %.2f deg -> Angle: %d\n", tiltTable[i & (kTableSize - 1)], angle));
+  });
+}
+
+void bench_liveness() {
+  PeerLiveness peer(300, 2);
+  bench::run("liveness_poll_4_clients", [&](uint64_t i) {
+    const uint32_t now = static_cast<uint32_t>(i);
+    for (int c = 0; c < 4; ++c) bench::doNotOptimize(peer.poll(now));
+    peer.heard(now);
+  });
+}
+
+struct NullManeuverSink {
+  int commands = 0;
+  void tilt(float) { ++commands; }
+  void gas(bool) { ++commands; }
+  void headlight(bool) { ++commands; }
+  void handbrake() { ++commands; }
+};
+
+// Per-tick cost of playback on the control path, mid-sweep.
+void bench_maneuver_tick() {
+  Maneuver m;
+  parseManeuver("g1 [ s25,400 s-25,800 s0,400 ]300", m);
+  ManeuverPlayer player;
+  NullManeuverSink sink;
+  bench::run("maneuver_tick", [&](uint64_t) {
+    if (!player.running()) player.start(m, 0.0f);
+    player.tick(motorUpdateIntervalMs, sink);
+  });
+  bench::doNotOptimize(sink.commands);
+}
+
+int main(int, char **) {
+  fillTables();
+  UNITY_BEGIN();
+  RUN_TEST(bench_map_tilt_to_angle);
+  RUN_TEST(bench_servo_duty);
+  RUN_TEST(bench_motor_pwm);
+  RUN_TEST(bench_motor_tick);
+  RUN_TEST(bench_parse_commands);
+  RUN_TEST(bench_format_state);
+  RUN_TEST(bench_broadcast_fanout);
+  RUN_TEST(bench_actuator);
+  RUN_TEST(bench_metrics);
+  RUN_TEST(bench_channel_select);
+  RUN_TEST(bench_async_log);
+  RUN_TEST(bench_liveness);
+  RUN_TEST(bench_maneuver_tick);
+  const int failures = UNITY_END();
+  if (!bench::writeReport("bench_output.txt")) return 1;
+  return failures;
+}
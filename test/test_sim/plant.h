@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+
+// Longitudinal model of the car for the native simulator.
+//
+// The motor drives the wheel toward a free-running speed proportional to
+// duty x battery, less what rolling resistance eats, with first-order lag.
+// While the tyres grip, wheel and car move together. Once the wheel is asked
+// to accelerate harder than gripAccelMps2 it breaks loose: the unloaded wheel
+// spins up much faster, the car only gains gripAccelMps2, until the two speeds
+// meet again. The encoder sees the wheel, not the car.
+struct PlantParams {
+  float topSpeedMps = 8.0f;     // free-running speed at full duty, fresh battery
+  float battery = 1.0f;         // 1.0 fresh, 0.8 sagged pack
+  float dragDuty = 0.05f;       // duty lost to rolling resistance (surface)
+  float tauS = 0.35f;           // loaded wheel/car time constant
+  float spinTauS = 0.06f;       // time constant of a wheel that has broken loose
+  float gripAccelMps2 = 6.0f;   // hardest acceleration the tyres transmit
+  float pulsesPerMeter = 200.0f;
+};
+
+class Plant {
+public:
+  explicit Plant(const PlantParams &p) : p_(p) {}
+
+  void step(float duty, float dtS) {
+    float drive = duty * p_.battery - p_.dragDuty;
+    if (drive < 0.0f) drive = 0.0f;
+    const float freeSpeed = drive * p_.topSpeedMps;
+
+    if (!spinning_) {
+      float accel = (freeSpeed - wheelMps_) / p_.tauS;
+      if (accel > p_.gripAccelMps2) {
+        spinning_ = true;
+      } else {
+        wheelMps_ += accel * dtS;
+        if (wheelMps_ < 0.0f) wheelMps_ = 0.0f;
+        carMps_ = wheelMps_;
+      }
+    }
+    if (spinning_) {
+      wheelMps_ += (freeSpeed - wheelMps_) / p_.spinTauS * dtS;
+      carMps_ += p_.gripAccelMps2 * dtS;
+      if (wheelMps_ <= carMps_) {
+        carMps_ = wheelMps_;
+        spinning_ = false;
+      }
+      spinTimeS_ += dtS;
+    }
+
+    pulseAccum_ += wheelMps_ * dtS * p_.pulsesPerMeter;
+    carDistanceM_ += carMps_ * dtS;
+  }
+
+  // Whole encoder pulses since the last call, as the PCNT unit would count.
+  uint32_t takePulses() {
+    const uint32_t whole = static_cast<uint32_t>(pulseAccum_);
+    pulseAccum_ -= static_cast<float>(whole);
+    return whole;
+  }
+
+  float carMps() const { return carMps_; }
+  float wheelMps() const { return wheelMps_; }
+  float slipMps() const { return wheelMps_ - carMps_; }
+  float spinTimeS() const { return spinTimeS_; }
+  float carDistanceM() const { return carDistanceM_; }
+
+private:
+  PlantParams p_;
+  float wheelMps_ = 0.0f;
+  float carMps_ = 0.0f;
+  float pulseAccum_ = 0.0f;
+  float carDistanceM_ = 0.0f;
+  float spinTimeS_ = 0.0f;
+  bool spinning_ = false;
+};
@@ -0,0 +1,334 @@
+// Closed-loop simulation of the drive train against a plant model.
+//
+//   pio test -e native -f test_sim
+//
+// Runs the firmware's throttle ramp and speed controller at the firmware's
+// control rate against Plant (plant.h) on a 1 ms step, to check each profile's
+// tuning in vehicle_profiles.h before it goes on the car. Every test runs for
+// every profile, against a plant model of that chassis. Maneuver scripts
+// (maneuver.h) run here exactly as the car plays them, so a run can be
+// previewed off the car.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "car_config.h"
+#include "control.h"
+#include "maneuver.h"
+#include "plant.h"
+#include "speed_control.h"
+
+namespace {
+
+// Plant model of each profile's chassis: how fast it runs at full duty, how
+// quickly it responds, and what its tyres transmit on a good and a slippery
+// surface.
+template <typename P>
+struct Chassis;
+
+template <>
+struct Chassis<BuggyProfile> {
+  static constexpr const char *name = "buggy";
+  static constexpr float topSpeedMps = 8.0f;
+  static constexpr float tauS = 0.35f;
+  static constexpr float gripMps2 = 6.0f;
+  static constexpr float lowGripMps2 = 3.0f;
+};
+
+// Geared down hard: slow, heavy and grippy on rock, but a wet slab still lets
+// the ramp alone break the tyres loose.
+template <>
+struct Chassis<CrawlerProfile> {
+  static constexpr const char *name = "crawler";
+  static constexpr float topSpeedMps = 3.5f;
+  static constexpr float tauS = 0.5f;
+  static constexpr float gripMps2 = 4.0f;
+  static constexpr float lowGripMps2 = 1.2f;
+};
+
+struct DriveResult {
+  float finalMps;       // car speed at the end of the run
+  float worstErrorPct;  // largest deviation from the target over the last second
+  float riseS;          // time to 90% of the target, -1 if never
+  float spinTimeS;      // time the wheel spent spinning
+  float peakSlipMps;    // largest wheel-minus-car speed
+};
+
+// Holds the gas for `seconds`, exactly as the firmware would: stepMotorDuty()
+// every motorUpdateIntervalMs, and with closedLoop the speed controller in the
+// same tick. Without it the ramped throttle goes straight to the motor.
+template <typename P>
+DriveResult drive(const PlantParams &params, bool closedLoop, float seconds) {
+  Plant plant(params);
+  SpeedController controller(speedGainsFor<P>());
+  EncoderSpeed encoder(params.pulsesPerMeter);
+  const float target = P::speedMaxMps;
+
+  DriveResult r = {0.0f, 0.0f, -1.0f, 0.0f, 0.0f};
+  float throttle = 0.0f;
+  float duty = 0.0f;
+  const uint32_t totalMs = static_cast<uint32_t>(seconds * 1000.0f);
+  for (uint32_t ms = 0; ms < totalMs; ++ms) {
+    if (ms % motorUpdateIntervalMs == 0) {
+      throttle = stepMotorDuty<P>(throttle, true, motorUpdateIntervalMs);
+      const float measured = encoder.update(plant.takePulses(), motorUpdateIntervalMs);
+      duty = closedLoop ? controller.update(speedRequest<P>(throttle), measured, motorUpdateIntervalMs) : throttle;
+    }
+    plant.step(duty, 0.001f);
+
+    if (r.riseS < 0.0f && plant.carMps() >= 0.9f * target) r.riseS = ms / 1000.0f;
+    if (plant.slipMps() > r.peakSlipMps) r.peakSlipMps = plant.slipMps();
+    if (ms + 1000 >= totalMs) {
+      const float errorPct = 100.0f * fabsf(plant.carMps() - target) / target;
+      if (errorPct > r.worstErrorPct) r.worstErrorPct = errorPct;
+    }
+  }
+  r.finalMps = plant.carMps();
+  r.spinTimeS = plant.spinTimeS();
+  return r;
+}
+
+template <typename P>
+PlantParams condition(float battery, float dragDuty, bool lowGrip = false) {
+  PlantParams p;
+  p.topSpeedMps = Chassis<P>::topSpeedMps;
+  p.tauS = Chassis<P>::tauS;
+  p.battery = battery;
+  p.dragDuty = dragDuty;
+  p.gripAccelMps2 = lowGrip ? Chassis<P>::lowGripMps2 : Chassis<P>::gripMps2;
+  p.pulsesPerMeter = P::encoderPulsesPerMeter;
+  return p;
+}
+
+template <typename P>
+void report(const char *name, const DriveResult &r) {
+  printf("%-8s %-28s final %5.2f m/s  err %5.1f%%  rise %5.2f s  spin %5.2f s  peak slip %5.2f m/s\n",
+         Chassis<P>::name, name, r.finalMps, r.worstErrorPct, r.riseS, r.spinTimeS, r.peakSlipMps);
+}
+
+// Fresh and sagged battery, smooth floor and carpet: open loop, top speed
+// follows the conditions; closed loop holds the requested speed, full
+// throttle asking for speedMaxMps whatever the profile's motorDutyMax.
+template <typename P>
+void test_speed_holds_through_sag_and_surface() {
+  const struct {
+    const char *name;
+    PlantParams params;
+  } cases[] = {
+      {"fresh battery, floor", condition<P>(1.0f, 0.05f)},
+      {"fresh battery, carpet", condition<P>(1.0f, 0.15f)},
+      {"sagged battery, floor", condition<P>(0.8f, 0.05f)},
+      {"sagged battery, carpet", condition<P>(0.8f, 0.15f)},
+  };
+  float openMin = 1e9f, openMax = 0.0f;
+  for (const auto &c : cases) {
+    const DriveResult open = drive<P>(c.params, false, 5.0f);
+    const DriveResult closed = drive<P>(c.params, true, 5.0f);
+    char label[40];
+    snprintf(label, sizeof(label), "open   %s", c.name);
+    report<P>(label, open);
+    snprintf(label, sizeof(label), "closed %s", c.name);
+    report<P>(label, closed);
+
+    if (open.finalMps < openMin) openMin = open.finalMps;
+    if (open.finalMps > openMax) openMax = open.finalMps;
+    TEST_ASSERT_TRUE(closed.worstErrorPct < 3.0f);
+    TEST_ASSERT_TRUE(closed.riseS > 0.0f && closed.riseS < 2.0f);
+  }
+  // The problem being solved: open loop spreads by more than a third.
+  TEST_ASSERT_TRUE(openMax / openMin > 1.3f);
+}
+
+// Low-grip launch: the throttle ramp alone still breaks the wheels loose;
+// launch and wheelspin limiting keep slip short and small.
+template <typename P>
+void test_launch_traction_limit() {
+  const PlantParams slippery = condition<P>(1.0f, 0.05f, true);
+  const DriveResult open = drive<P>(slippery, false, 4.0f);
+  const DriveResult closed = drive<P>(slippery, true, 4.0f);
+  report<P>("open   launch, low grip", open);
+  report<P>("closed launch, low grip", closed);
+
+  TEST_ASSERT_TRUE(open.spinTimeS > 0.3f);
+  TEST_ASSERT_TRUE(closed.spinTimeS < open.spinTimeS / 2.0f);
+  TEST_ASSERT_TRUE(closed.peakSlipMps < open.peakSlipMps / 2.0f);
+  TEST_ASSERT_TRUE(closed.worstErrorPct < 3.0f);
+}
+
+// Letting off the gas must cut the motor right away, not wait for the loop.
+template <typename P>
+void test_zero_throttle_cuts_output() {
+  SpeedController controller(speedGainsFor<P>());
+  TEST_ASSERT_TRUE(controller.update(speedRequest<P>(P::motorDutyMax), 0.0f, motorUpdateIntervalMs) > 0.0f);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, controller.update(0.0f, 3.0f, motorUpdateIntervalMs));
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, controller.target());
+}
+
+void test_encoder_speed() {
+  EncoderSpeed encoder(200.0f);
+  // 1 m/s at 200 pulses/m is 4 pulses per 20 ms tick.
+  float mps = 0.0f;
+  for (int i = 0; i < EncoderSpeed::kWindow; ++i) mps = encoder.update(4, 20);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 1.0f, mps);
+  // Alternating 3/4 pulses (0.875 m/s) averages out instead of jumping.
+  for (int i = 0; i < EncoderSpeed::kWindow; ++i) mps = encoder.update(i % 2 ? 4 : 3, 20);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.875f, mps);
+}
+
+// Maneuver sink for the simulator: the same control math the firmware's
+// entry points run, plus a log of the tick each command landed on.
+template <typename P>
+struct SimCar {
+  struct Command {
+    uint32_t tick;
+    char op;
+    float value;
+    bool operator==(const Command &o) const { return tick == o.tick && op == o.op && value == o.value; }
+  };
+
+  uint32_t tickNo = 0;
+  bool gasPressed = false;
+  float throttle = 0.0f;
+  int angle = mapTiltToAngle<P>(0.0f);
+  std::vector<Command> log;
+
+  void tilt(float deg) {
+    angle = mapTiltToAngle<P>(deg);
+    log.push_back({tickNo, 't', deg});
+  }
+  void gas(bool on) {
+    gasPressed = on;
+    log.push_back({tickNo, 'g', on ? 1.0f : 0.0f});
+  }
+  void headlight(bool on) { log.push_back({tickNo, 'l', on ? 1.0f : 0.0f}); }
+  void handbrake() {
+    gasPressed = false;
+    throttle = 0.0f;
+    log.push_back({tickNo, 'h', 0.0f});
+  }
+};
+
+template <typename P>
+struct ManeuverRun {
+  SimCar<P> car;
+  float peakMps = 0.0f;
+  float toSpeedS = -1.0f;  // time to 80% of speedMaxMps
+  float distanceM = 0.0f;
+  std::vector<int> angles;  // steering angle per tick
+};
+
+// Plays `script` the way the car does: one player tick, then the throttle
+// ramp and the motor output, every motorUpdateIntervalMs. `abortAtTick`
+// stands in for a handbrake frame arriving before that tick.
+template <typename P>
+ManeuverRun<P> playManeuver(const char *script, const PlantParams &params, uint32_t abortAtTick = UINT32_MAX) {
+  Maneuver maneuver;
+  TEST_ASSERT_TRUE(parseManeuver(script, maneuver));
+  ManeuverPlayer player;
+  player.start(maneuver, 0.0f);
+
+  ManeuverRun<P> run;
+  Plant plant(params);
+  SpeedController controller(speedGainsFor<P>());
+  EncoderSpeed encoder(params.pulsesPerMeter);
+  float duty = 0.0f;
+  for (uint32_t ms = 0; player.running() || plant.carMps() > 0.01f; ++ms) {
+    if (ms % motorUpdateIntervalMs == 0) {
+      run.car.tickNo = ms / motorUpdateIntervalMs;
+      if (run.car.tickNo == abortAtTick && player.running()) {
+        player.abort();
+        run.car.handbrake();
+      }
+      player.tick(motorUpdateIntervalMs, run.car);
+      run.car.throttle = stepMotorDuty<P>(run.car.throttle, run.car.gasPressed, motorUpdateIntervalMs);
+      const float measured = encoder.update(plant.takePulses(), motorUpdateIntervalMs);
+      duty = P::encoderPin >= 0
+                 ? controller.update(speedRequest<P>(run.car.throttle), measured, motorUpdateIntervalMs)
+                 : run.car.throttle;
+      run.angles.push_back(run.car.angle);
+    }
+    plant.step(duty, 0.001f);
+    if (plant.carMps() > run.peakMps) run.peakMps = plant.carMps();
+    if (run.toSpeedS < 0.0f && plant.carMps() >= 0.8f * P::speedMaxMps) run.toSpeedS = ms / 1000.0f;
+    if (ms > 60000) break;
+  }
+  run.distanceM = plant.carDistanceM();
+  return run;
+}
+
+constexpr char kLaunchScript[] = "g1 w3000 g0 w1500 h";
+constexpr char kSlalomScript[] = "g1 w600 [ s25,400 s-25,800 s0,400 ]4 g0 w1000 h";
+
+// A launch lands every command on the tick its time names, and two runs are
+// identical command for command and metre for metre.
+template <typename P>
+void test_maneuver_launch_is_tick_exact() {
+  const PlantParams floor = condition<P>(1.0f, 0.05f);
+  const ManeuverRun<P> a = playManeuver<P>(kLaunchScript, floor);
+  const ManeuverRun<P> b = playManeuver<P>(kLaunchScript, floor);
+  printf("%-8s maneuver launch: 0-%.1f m/s %.2f s, peak %.2f m/s, %.2f m\n", Chassis<P>::name,
+         0.8f * P::speedMaxMps, a.toSpeedS, a.peakMps, a.distanceM);
+
+  const std::vector<typename SimCar<P>::Command> expected = {
+      {0, 'g', 1.0f}, {3000 / motorUpdateIntervalMs, 'g', 0.0f}, {4500 / motorUpdateIntervalMs, 'h', 0.0f},
+      {4500 / motorUpdateIntervalMs, 'g', 0.0f}};
+  TEST_ASSERT_TRUE(a.car.log == expected);
+  TEST_ASSERT_TRUE(a.car.log == b.car.log);
+  TEST_ASSERT_EQUAL_FLOAT(a.distanceM, b.distanceM);
+  TEST_ASSERT_TRUE(a.toSpeedS > 0.0f);
+}
+
+// A slalom reaches both steering extremes once per pass, at the scheduled
+// ticks, and ends straight.
+template <typename P>
+void test_maneuver_slalom_sweeps() {
+  const ManeuverRun<P> run = playManeuver<P>(kSlalomScript, condition<P>(1.0f, 0.05f));
+  const int left = mapTiltToAngle<P>(25.0f);
+  const int right = mapTiltToAngle<P>(-25.0f);
+  for (uint32_t pass = 0; pass < 4; ++pass) {
+    const uint32_t passStartMs = 600 + pass * 1600;
+    TEST_ASSERT_EQUAL_INT(left, run.angles[(passStartMs + 400) / motorUpdateIntervalMs]);
+    TEST_ASSERT_EQUAL_INT(right, run.angles[(passStartMs + 1200) / motorUpdateIntervalMs]);
+  }
+  TEST_ASSERT_EQUAL_INT(mapTiltToAngle<P>(0.0f), run.car.angle);
+  printf("%-8s maneuver slalom: %.2f m, peak %.2f m/s\n", Chassis<P>::name, run.distanceM, run.peakMps);
+}
+
+// A handbrake mid-run stops the script on that tick: nothing it would have
+// done later is applied, and the motor is cut.
+template <typename P>
+void test_maneuver_handbrake_aborts() {
+  const uint32_t abortTick = 1000 / motorUpdateIntervalMs;
+  const ManeuverRun<P> run = playManeuver<P>(kLaunchScript, condition<P>(1.0f, 0.05f), abortTick);
+  TEST_ASSERT_EQUAL_UINT(2, run.car.log.size());
+  TEST_ASSERT_EQUAL_UINT(abortTick, run.car.log.back().tick);
+  TEST_ASSERT_EQUAL('h', run.car.log.back().op);
+  TEST_ASSERT_FALSE(run.car.gasPressed);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, run.car.throttle);
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_encoder_speed);
+  RUN_TEST(test_zero_throttle_cuts_output<BuggyProfile>);
+  RUN_TEST(test_zero_throttle_cuts_output<CrawlerProfile>);
+  RUN_TEST(test_speed_holds_through_sag_and_surface<BuggyProfile>);
+  RUN_TEST(test_speed_holds_through_sag_and_surface<CrawlerProfile>);
+  RUN_TEST(test_launch_traction_limit<BuggyProfile>);
+  RUN_TEST(test_launch_traction_limit<CrawlerProfile>);
+  RUN_TEST(test_maneuver_launch_is_tick_exact<BuggyProfile>);
+  RUN_TEST(test_maneuver_launch_is_tick_exact<CrawlerProfile>);
+  RUN_TEST(test_maneuver_slalom_sweeps<BuggyProfile>);
+  RUN_TEST(test_maneuver_slalom_sweeps<CrawlerProfile>);
+  RUN_TEST(test_maneuver_handbrake_aborts<BuggyProfile>);
+  RUN_TEST(test_maneuver_handbrake_aborts<CrawlerProfile>);
+  return UNITY_END();
+}
@@ -0,0 +1,603 @@
+// Unit tests for the Arduino-free headers in include/.
+//
+//   pio test -e native -f test_unit
+//
+// Timings live in test_bench; the drive-train simulator in test_sim.
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include "actuator.h"
+#include "admission.h"
+#include "async_log.h"
+#include "boot_phases.h"
+#include "channel_select.h"
+#include "liveness.h"
+#include "loop_stats.h"
+#include "maneuver.h"
+#include "metrics.h"
+#include "control.h"
+#include "protocol.h"
+#include "tls_budget.h"
+
+namespace {
+
+// Mirrors updateMotorControl() without the timer and ledcWrite(). Counts the
+// state broadcasts a ramp causes, with the 1%-step policy the UI used to need
+// (legacyBroadcasts) and with ramp extrapolation (broadcasts).
+struct MotorTickModel {
+  float duty = 0.0f;
+  bool gas = false;
+  uint32_t nowMs = 0;
+  uint32_t lastCorrectionMs = 0;
+  float lastLegacyDuty = -1.0f;
+  uint32_t broadcasts = 0;
+  uint32_t legacyBroadcasts = 0;
+
+  void setGas(bool on) {
+    if (on == gas) return;
+    gas = on;
+    lastCorrectionMs = nowMs;
+    ++broadcasts;  // ramp frame on the edge
+    ++legacyBroadcasts;
+  }
+
+  void tick(bool gasHeld) {
+    setGas(gasHeld);
+    nowMs += motorUpdateIntervalMs;
+    const float newDuty = stepMotorDuty(duty, gas, motorUpdateIntervalMs);
+    if (fabsf(newDuty - duty) < 0.0001f) return;
+    duty = newDuty;
+    if (rampResyncDue(duty, nowMs - lastCorrectionMs)) {
+      lastCorrectionMs = nowMs;
+      ++broadcasts;
+    }
+    if (fabsf(duty - lastLegacyDuty) >= 0.01f) {
+      lastLegacyDuty = duty;
+      ++legacyBroadcasts;
+    }
+  }
+};
+
+// Mirrors the frame extraction at the top of SteeringWebsocket::onMessage().
+Command readAndParse(std::stringbuf &frame, float &tilt) {
+  frame.pubseekpos(0, std::ios_base::in);
+  std::ostringstream ss;
+  ss << &frame;
+  return parseCommand(ss.str(), tilt);
+}
+
+// The snprintf formatter that formatState() replaced; kept as the reference output.
+int formatStateSnprintf(char *out, size_t size, const CarState &state) {
+  return snprintf(out, size, "{\"angle\":%d,\"tilt\":%.2f,\"motorDuty\":%.3f,\"gas\":%s,\"headlight\":%s}",
+                  state.angle, state.tilt, state.motorDuty, state.gas ? "true" : "false",
+                  state.headlight ? "true" : "false");
+}
+
+Counter unitFramesA("unit_frames_total", "command=\"a\"", "Frames by command");
+Counter unitFramesB("unit_frames_total", "command=\"b\"", "");
+CallbackMetric unitHeap("unit_free_bytes", "", "Free bytes", MetricType::Gauge, [] { return 4096u; });
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+void test_map_tilt_to_angle() {
+  TEST_ASSERT_EQUAL_INT(Vehicle::servoMin + Vehicle::servoMax - mapTiltToAngle(Vehicle::tiltMax),
+                        mapTiltToAngle(Vehicle::tiltMin));
+  TEST_ASSERT_EQUAL_INT((Vehicle::servoMin + Vehicle::servoMax) / 2, mapTiltToAngle(0.0f));
+}
+
+void test_servo_duty() {
+  TEST_ASSERT_EQUAL_UINT32(
+      (static_cast<uint64_t>(Vehicle::servoPulseMinUs) * ((1u << servoResolution) - 1u)) / servoPeriodUs,
+      servoDutyForAngle(Vehicle::servoMin));
+}
+
+// Both shipped profiles build, and each maps tilt and angle the way its
+// constants say: inversion only swaps which end of the tilt range is servoMin.
+void test_vehicle_profiles() {
+  TEST_ASSERT_TRUE(BuggyProfile::invertSteering);
+  TEST_ASSERT_EQUAL_INT(BuggyProfile::servoMax, mapTiltToAngle<BuggyProfile>(BuggyProfile::tiltMin));
+  TEST_ASSERT_EQUAL_INT(BuggyProfile::servoMin, mapTiltToAngle<BuggyProfile>(BuggyProfile::tiltMax));
+  TEST_ASSERT_FALSE(CrawlerProfile::invertSteering);
+  TEST_ASSERT_EQUAL_INT(CrawlerProfile::servoMin, mapTiltToAngle<CrawlerProfile>(CrawlerProfile::tiltMin - 10.0f));
+  TEST_ASSERT_EQUAL_INT(CrawlerProfile::servoMax, mapTiltToAngle<CrawlerProfile>(CrawlerProfile::tiltMax));
+  TEST_ASSERT_EQUAL_INT((CrawlerProfile::servoMin + CrawlerProfile::servoMax) / 2, mapTiltToAngle<CrawlerProfile>(0.0f));
+
+  static_assert(ServoDutyTable<CrawlerProfile>::duty.size() == CrawlerProfile::servoMax - CrawlerProfile::servoMin + 1,
+                "one duty entry per angle");
+  const uint64_t maxDuty = (1u << servoResolution) - 1u;
+  TEST_ASSERT_EQUAL_UINT32(CrawlerProfile::servoPulseMinUs * maxDuty / servoPeriodUs,
+                           servoDutyForAngle<CrawlerProfile>(0));
+  TEST_ASSERT_EQUAL_UINT32(CrawlerProfile::servoPulseMaxUs * maxDuty / servoPeriodUs,
+                           servoDutyForAngle<CrawlerProfile>(180));
+  TEST_ASSERT_EQUAL_UINT32(motorPwmForDuty<CrawlerProfile>(CrawlerProfile::motorDutyMax),
+                           motorPwmForDuty<CrawlerProfile>(1.0f));
+  TEST_ASSERT_EQUAL_FLOAT(CrawlerProfile::motorDutyMax, stepMotorDuty<CrawlerProfile>(0.0f, true, 10000));
+  // The ramp stops at motorDutyMax, and that is full throttle for the speed loop.
+  TEST_ASSERT_EQUAL_FLOAT(1.0f, speedRequest<CrawlerProfile>(stepMotorDuty<CrawlerProfile>(0.0f, true, 10000)));
+}
+
+void test_motor_pwm() {
+  const uint32_t maxPwm = (1u << Vehicle::motorResolution) - 1u;
+  TEST_ASSERT_EQUAL_UINT32(lroundf(Vehicle::motorDutyMax * maxPwm), motorPwmForDuty(Vehicle::motorDutyMax));
+  TEST_ASSERT_EQUAL_UINT32(motorPwmForDuty(Vehicle::motorDutyMax), motorPwmForDuty(2.0f));
+  TEST_ASSERT_EQUAL_UINT32(0, motorPwmForDuty(-1.0f));
+}
+
+void test_motor_tick() {
+  // Mid-ramp ticks resync on the interval; either end resyncs at once.
+  TEST_ASSERT_FALSE(rampResyncDue(Vehicle::motorDutyMax / 2, motorCorrectionIntervalMs - 1));
+  TEST_ASSERT_TRUE(rampResyncDue(Vehicle::motorDutyMax / 2, motorCorrectionIntervalMs));
+  TEST_ASSERT_TRUE(rampResyncDue(0.0f, 0));
+  TEST_ASSERT_TRUE(rampResyncDue(Vehicle::motorDutyMax, 0));
+
+  MotorTickModel model;
+  for (int i = 0; i < 100; ++i) model.tick(true);
+  TEST_ASSERT_EQUAL_FLOAT(Vehicle::motorDutyMax, model.duty);
+
+  // A full press and release costs each client about 100 frames with 1%
+  // steps; with extrapolation it is the two edges plus a few corrections.
+  for (int i = 0; i < 100; ++i) model.tick(false);
+  TEST_ASSERT_EQUAL_FLOAT(0.0f, model.duty);
+  printf("full press+release: %u frames per client (was %u)\n", model.broadcasts, model.legacyBroadcasts);
+  TEST_ASSERT_TRUE(model.broadcasts * 10 <= model.legacyBroadcasts);
+}
+
+void test_parse_commands() {
+  const struct {
+    const char *frame;
+    Command expected;
+  } cases[] = {
+      {"sync", Command::Sync},
+      {"gas_on", Command::GasOn},
+      {"gas_off", Command::GasOff},
+      {"handbrake", Command::Handbrake},
+      {"headlight_on", Command::HeadlightOn},
+      {"headlight_off", Command::HeadlightOff},
+      {"hello:k3j9x0", Command::Hello},
+      {"pong", Command::Pong},
+      {"maneuver:g1 w3000 g0", Command::Maneuver},
+      {"maneuver_run", Command::ManeuverRun},
+      {"-12.34", Command::Tilt},
+      {"steer_left", Command::Invalid},
+  };
+  float tilt = 0.0f;
+  for (const auto &c : cases) {
+    TEST_ASSERT_EQUAL_MESSAGE(static_cast<int>(c.expected), static_cast<int>(parseCommand(c.frame, tilt)), c.frame);
+  }
+
+  std::stringbuf frame("-12.34");
+  TEST_ASSERT_EQUAL(static_cast<int>(Command::Tilt), static_cast<int>(readAndParse(frame, tilt)));
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, -12.34f, tilt);
+}
+
+void test_format_ramp() {
+  char frame[kRampFrameMax];
+  const RampParams ramp{0.25f, true, 1.0f / 600.0f, 1.0f / 900.0f, 0.8f};
+  formatRamp(frame, sizeof(frame), ramp);
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"ramp\":{\"duty\":0.250,\"gas\":true,\"accel\":0.001667,\"decel\":0.001111,\"max\":0.800}}", frame);
+}
+
+void test_format_state() {
+  char payload[kStateFrameMax];
+  char reference[kStateFrameMax];
+  const CarState typical{73, -12.34f, 0.456f, true, false};
+  formatState(payload, sizeof(payload), typical);
+  TEST_ASSERT_EQUAL_STRING("{\"angle\":73,\"tilt\":-12.34,\"motorDuty\":0.456,\"gas\":true,\"headlight\":false}", payload);
+
+  for (int i = 0; i <= 900; ++i) {
+    const CarState state{Vehicle::servoMin + i % 91, -45.0f + 0.1f * i, i / 900.0f, (i & 1) != 0, (i & 2) != 0};
+    formatState(payload, sizeof(payload), state);
+    formatStateSnprintf(reference, sizeof(reference), state);
+    TEST_ASSERT_EQUAL_STRING(reference, payload);
+  }
+}
+
+void test_state_frame_cache() {
+  StateFrameCache cache;
+  const CarState state{90, 1.0f, 0.5f, false, true};
+  const StateFramePtr first = cache.get(state);
+  TEST_ASSERT_TRUE(first == cache.get(state));
+  TEST_ASSERT_EQUAL_UINT32(1, cache.encodes());
+  CarState moved = state;
+  moved.motorDuty = 0.6f;
+  TEST_ASSERT_FALSE(first == cache.get(moved));
+  TEST_ASSERT_EQUAL_UINT32(2, cache.encodes());
+}
+
+void test_actuator() {
+  Actuator servo(servoPeriodUs, servoCommitWindowUs);
+  servo.anchor(0);
+  servo.request(100, 0);
+  TEST_ASSERT_TRUE(servo.service(0));  // first value goes out immediately
+
+  // Three changes early in the next period collapse into one late write.
+  servo.request(200, 21000);
+  servo.request(300, 22000);
+  servo.request(400, 23000);
+  TEST_ASSERT_FALSE(servo.service(23000));
+  TEST_ASSERT_TRUE(servo.service(38500));
+  TEST_ASSERT_EQUAL_UINT32(400, servo.value());
+  TEST_ASSERT_EQUAL_UINT32(2, servo.writesIssued());
+  TEST_ASSERT_EQUAL_UINT32(2, servo.writesSkipped());
+
+  // Re-requesting the committed value never writes.
+  servo.request(400, 40000);
+  TEST_ASSERT_FALSE(servo.service(58500));
+  TEST_ASSERT_EQUAL_UINT32(3, servo.writesSkipped());
+
+  // A change whose window passed without a service() call goes out on the next one.
+  servo.request(500, 59000);
+  TEST_ASSERT_TRUE(servo.service(70000));
+
+  // usUntilDue() tells the main loop how long it may sleep.
+  Actuator steer(servoPeriodUs, servoCommitWindowUs);
+  steer.anchor(0);
+  TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, steer.usUntilDue(0));
+  steer.request(100, 0);
+  TEST_ASSERT_EQUAL_UINT32(0, steer.usUntilDue(0));
+  steer.service(0);
+  steer.request(200, 5000);
+  TEST_ASSERT_EQUAL_UINT32(33000, steer.usUntilDue(5000));  // window of the next period
+  TEST_ASSERT_FALSE(steer.service(37999));
+  TEST_ASSERT_TRUE(steer.service(38000));
+}
+
+// micros() wraps about 71.6 min after boot. Outputs must keep committing
+// across it, and the handbrake's zero must still go out within two periods.
+void test_actuator_across_micros_wrap() {
+  const struct {
+    uint32_t periodUs;
+    uint32_t windowUs;
+  } outputs[] = {{50, 50}, {1000, 1000}, {servoPeriodUs, servoCommitWindowUs}};
+  for (const auto &o : outputs) {
+    Actuator out(o.periodUs, o.windowUs);
+    uint32_t now = UINT32_MAX - 7000;
+    out.anchor(123457);  // timer configured during setup()
+    out.request(1, now);
+    TEST_ASSERT_TRUE(out.service(now));
+
+    // 10 s of a new value every 500 us, the loop servicing every 10 us.
+    uint32_t writes = 0;
+    uint32_t lastWriteUs = now;
+    uint32_t longestGapUs = 0;
+    for (uint32_t step = 1; step <= 1000000; ++step) {
+      now += 10;
+      if (step % 50 == 0) out.request(step, now);
+      if (out.pending()) TEST_ASSERT_TRUE(out.usUntilDue(now) <= 2 * o.periodUs);
+      if (!out.service(now)) continue;
+      ++writes;
+      if (now - lastWriteUs > longestGapUs) longestGapUs = now - lastWriteUs;
+      lastWriteUs = now;
+    }
+    TEST_ASSERT_TRUE(longestGapUs <= 2 * o.periodUs + 500);
+    TEST_ASSERT_TRUE(writes >= 10000000u / (o.periodUs > 500 ? o.periodUs : 500) - 1);
+
+    // A handbrake long after the wrap: zero is requested and goes out in time.
+    out.request(0, now);
+    uint32_t waitedUs = 0;
+    while (waitedUs <= 2 * o.periodUs && !out.service(now + waitedUs)) waitedUs += 10;
+    TEST_ASSERT_TRUE(waitedUs <= 2 * o.periodUs);
+    TEST_ASSERT_EQUAL_UINT32(0, out.value());
+  }
+}
+
+void test_loop_stats() {
+  LoopStats stats;
+  stats.recordAwake(1000);
+  stats.recordBlocked(9000);
+  stats.recordWake(true);
+  stats.recordWake(false);
+  stats.recordWakeLatency(100);
+  stats.recordWakeLatency(300);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 90.0f, stats.idlePercent());
+  TEST_ASSERT_EQUAL_UINT32(2, stats.wakes());
+  TEST_ASSERT_EQUAL_UINT32(1, stats.networkWakes());
+  TEST_ASSERT_EQUAL_UINT32(200, stats.latencyAvgUs());
+  TEST_ASSERT_EQUAL_UINT32(300, stats.latencyMaxUs());
+}
+
+void test_metrics() {
+  unitFramesA.inc();
+  unitFramesB.inc(3);
+  std::string out;
+  renderPrometheus(out);
+  TEST_ASSERT_EQUAL_STRING(
+      "# HELP unit_frames_total Frames by command\n"
+      "# TYPE unit_frames_total counter\n"
+      "unit_frames_total{command=\"a\"} 1\n"
+      "unit_frames_total{command=\"b\"} 3\n"
+      "# HELP unit_free_bytes Free bytes\n"
+      "# TYPE unit_free_bytes gauge\n"
+      "unit_free_bytes 4096\n",
+      out.c_str());
+}
+
+// Scan recorded at a club meet: channel 1 and 6 crowded, a loud AP on 11.
+const ScanResult recordedScan[] = {
+    {1, -42}, {1, -67}, {1, -71}, {1, -80}, {2, -77}, {3, -85}, {6, -48}, {6, -55},
+    {6, -63}, {6, -70}, {6, -88}, {7, -81}, {11, -39}, {11, -90}, {9, -84}, {4, -91},
+};
+
+void test_channel_select() {
+  const size_t count = sizeof(recordedScan) / sizeof(recordedScan[0]);
+  const uint8_t best = pickQuietestChannel(recordedScan, count);
+  for (uint8_t ch = kFirstApChannel; ch <= kLastApChannel; ++ch) {
+    TEST_ASSERT_TRUE(channelCongestion(best, recordedScan, count) <= channelCongestion(ch, recordedScan, count));
+  }
+  TEST_ASSERT_TRUE(best != 1 && best != 6);
+
+  // Empty air: prefer channel 1 of the non-overlapping set.
+  TEST_ASSERT_EQUAL_UINT(1, pickQuietestChannel(nullptr, 0));
+
+  // A single loud AP on 1 pushes us at least five channels away, onto 6 or 11.
+  const ScanResult one[] = {{1, -30}};
+  TEST_ASSERT_EQUAL_UINT(6, pickQuietestChannel(one, 1));
+}
+
+void test_admission() {
+  // Two HTTP slots: a kept-alive scraper and a page load fit, a third does not.
+  TEST_ASSERT_TRUE(admitHttpRequest(3, 2, 2));
+  TEST_ASSERT_TRUE(admitHttpRequest(4, 2, 2));
+  TEST_ASSERT_FALSE(admitHttpRequest(5, 2, 2));
+
+  // Four WebSocket slots, driver away but within the grace period: spectators
+  // get three, the driver can still come back as the fourth.
+  TEST_ASSERT_TRUE(admitWsSession(2, 4, false, true));
+  TEST_ASSERT_FALSE(admitWsSession(3, 4, false, true));
+  TEST_ASSERT_TRUE(admitWsSession(3, 4, true, true));
+  TEST_ASSERT_TRUE(admitWsSession(3, 4, false, false));
+  TEST_ASSERT_FALSE(admitWsSession(4, 4, true, false));
+}
+
+uint32_t fakeClockUs() { return 12345678u; }
+
+int debugArgEvaluations = 0;
+int countedArg() { return ++debugArgEvaluations; }
+
+void test_async_log() {
+  AsyncLog log;
+  log.setClock(&fakeClockUs);
+  LogRecord record;
+  char line[160];
+
+  // Formatting on the drain side matches what Serial.printf printed inline.
+  const float tilt = 12.345f;
+  const int angle = 97;
+  TEST_ASSERT_TRUE(log.write(LOG_LEVEL_DEBUG, "Tilt: %.2f deg -> Angle: %d", tilt, angle));
+  TEST_ASSERT_TRUE(log.pop(record));
+  formatLogRecord(record, line, sizeof(line));
+  TEST_ASSERT_EQUAL_STRING("D 12.345 Tilt: 12.35 deg -> Angle: 97\n", line);
+
+  log.write(LOG_LEVEL_INFO, "idle %.1f%%, wakes %u, %s %5d|%-3u|%lu", 87.25f, 42u, "net", -7, 3u, 9ul);
+  TEST_ASSERT_TRUE(log.pop(record));
+  formatLogRecord(record, line, sizeof(line));
+  TEST_ASSERT_EQUAL_STRING("I 12.345 idle 87.2%, wakes 42, net    -7|3  |9\n", line);
+
+  // A format asking for more than was captured prints a marker, not garbage.
+  log.write(LOG_LEVEL_WARN, "a %d b %d", 1);
+  TEST_ASSERT_TRUE(log.pop(record));
+  formatLogRecord(record, line, sizeof(line));
+  TEST_ASSERT_EQUAL_STRING("W 12.345 a 1 b <?>\n", line);
+
+  // Truncation keeps the output terminated.
+  log.write(LOG_LEVEL_ERROR, "%s", "0123456789");
+  TEST_ASSERT_TRUE(log.pop(record));
+  TEST_ASSERT_EQUAL_UINT(15, formatLogRecord(record, line, 16));
+  TEST_ASSERT_EQUAL_STRING("E 12.345 012345", line);
+  TEST_ASSERT_FALSE(log.pop(record));
+
+  // A full ring drops and counts instead of blocking; draining frees it again.
+  for (int i = 0; i < LOG_RING_SLOTS; ++i) TEST_ASSERT_TRUE(log.write(LOG_LEVEL_INFO, "n=%d", i));
+  TEST_ASSERT_FALSE(log.write(LOG_LEVEL_INFO, "n=%d", -1));
+  TEST_ASSERT_FALSE(log.write(LOG_LEVEL_INFO, "n=%d", -2));
+  TEST_ASSERT_EQUAL_UINT32(2, log.dropped());
+  TEST_ASSERT_TRUE(log.pop(record));
+  TEST_ASSERT_EQUAL_INT(0, record.values[0].i);
+  TEST_ASSERT_TRUE(log.write(LOG_LEVEL_INFO, "n=%d", 64));
+  int last = -1;
+  while (log.pop(record)) last = record.values[0].i;
+  TEST_ASSERT_EQUAL_INT(64, last);
+
+  // Levels above LOG_LEVEL (INFO here) vanish, arguments included.
+  LOG_DEBUG("never %d", countedArg());
+  TEST_ASSERT_EQUAL_INT(0, debugArgEvaluations);
+}
+
+void test_boot_phases() {
+  BootPhases boot;
+  TEST_ASSERT_TRUE(boot.mark(BootPhase::ActuatorsSafe, 900));
+  TEST_ASSERT_FALSE(boot.mark(BootPhase::ActuatorsSafe, 5000));  // first mark wins
+  boot.mark(BootPhase::LogReady, 1400);
+  boot.mark(BootPhase::NetStackUp, 60000);
+  // AP task and server start overlap from NetStackUp.
+  boot.mark(BootPhase::ChannelPicked, 860000);
+  boot.mark(BootPhase::ServerUp, 310000);
+  boot.mark(BootPhase::ApUp, 905000);
+  boot.mark(BootPhase::Ready, 906000);
+
+  TEST_ASSERT_EQUAL_UINT32(900, boot.durationUs(BootPhase::ActuatorsSafe));
+  TEST_ASSERT_EQUAL_UINT32(500, boot.durationUs(BootPhase::LogReady));
+  TEST_ASSERT_EQUAL_UINT32(250000, boot.durationUs(BootPhase::ServerUp));
+  TEST_ASSERT_EQUAL_UINT32(800000, boot.durationUs(BootPhase::ChannelPicked));
+  TEST_ASSERT_EQUAL_UINT32(45000, boot.durationUs(BootPhase::ApUp));
+  TEST_ASSERT_EQUAL_UINT32(1000, boot.durationUs(BootPhase::Ready));
+  TEST_ASSERT_FALSE(boot.reached(BootPhase::FirstControl));
+  TEST_ASSERT_EQUAL_UINT32(0, boot.durationUs(BootPhase::FirstControl));
+  TEST_ASSERT_EQUAL_STRING("first control", bootPhaseName(BootPhase::FirstControl));
+}
+
+constexpr uint32_t kPingIntervalMs = 300;
+constexpr uint8_t kPingMissLimit = 2;
+
+struct ReclaimRun {
+  uint32_t reclaimMs;       // vanish to eviction, 0 if never evicted
+  uint32_t pings;           // pings sent over the whole run
+  uint32_t withheld;        // broadcasts skipped as suspect
+  bool suspectWhileAlive;   // a broadcast was held back from a live client
+};
+
+// One session on the car's loop. The phone answers pings after `rttMs` and,
+// as a spectator, sends nothing else. At `vanishMs` it walks out of range:
+// no close frame, no more replies. The loop passes every `loopMs` (the real
+// loop also wakes exactly when msUntilDue() says) and broadcasts a state
+// frame every 20 ms, as it does while someone else is driving.
+ReclaimRun simulateVanishedClient(uint32_t loopMs, uint32_t rttMs, uint32_t vanishMs) {
+  PeerLiveness peer(kPingIntervalMs, kPingMissLimit);
+  peer.heard(0);
+  ReclaimRun run = {0, 0, 0, false};
+  uint32_t pongDueMs = UINT32_MAX;
+  for (uint32_t now = 0; now < vanishMs + 10000; ++now) {
+    if (now == pongDueMs) {
+      peer.heard(now);
+      pongDueMs = UINT32_MAX;
+    }
+    if (now % 20 == 0 && peer.suspect(now)) {
+      ++run.withheld;
+      if (now < vanishMs) run.suspectWhileAlive = true;
+    }
+    if (now % loopMs != 0) continue;
+    const PeerLiveness::Action action = peer.poll(now);
+    if (action == PeerLiveness::Action::Ping) {
+      ++run.pings;
+      if (now + rttMs < vanishMs) pongDueMs = now + rttMs;
+    } else if (action == PeerLiveness::Action::Evict) {
+      run.reclaimMs = now - vanishMs;
+      break;
+    }
+  }
+  return run;
+}
+
+void test_liveness() {
+  // Exact wake-ups: evicted (missLimit + 1) intervals after the last frame.
+  const ReclaimRun exact = simulateVanishedClient(1, 40, 3000);
+  // Worst case: the loop only passes every 50 ms (activeMaxWaitUs).
+  const ReclaimRun coarse = simulateVanishedClient(50, 40, 3000);
+  // Slow phone: 250 ms round trip still counts as alive.
+  const ReclaimRun slow = simulateVanishedClient(1, 250, 3000);
+  printf("vanished client reclaimed after %u ms (loop every 1 ms), %u ms (every 50 ms), %u ms (250 ms RTT)\n",
+         exact.reclaimMs, coarse.reclaimMs, slow.reclaimMs);
+
+  const uint32_t bound = (kPingMissLimit + 1) * kPingIntervalMs;
+  TEST_ASSERT_TRUE(exact.reclaimMs > 0 && exact.reclaimMs <= bound);
+  TEST_ASSERT_TRUE(coarse.reclaimMs > 0 && coarse.reclaimMs <= bound + 50);
+  TEST_ASSERT_TRUE(slow.reclaimMs > 0 && slow.reclaimMs <= bound);
+  TEST_ASSERT_FALSE(exact.suspectWhileAlive);
+  TEST_ASSERT_FALSE(coarse.suspectWhileAlive);
+  TEST_ASSERT_FALSE(slow.suspectWhileAlive);
+  // Broadcasts stop a third of the way before eviction, not at it.
+  TEST_ASSERT_TRUE(exact.withheld >= (bound - 2 * kPingIntervalMs) / 20 - 1);
+  // An idle spectator costs one ping per interval.
+  TEST_ASSERT_TRUE(exact.pings <= 3000 / kPingIntervalMs + kPingMissLimit + 1);
+
+  // A chatty client (the driver sending tilt) is never pinged.
+  PeerLiveness driver(kPingIntervalMs, kPingMissLimit);
+  driver.heard(0);
+  for (uint32_t now = 0; now < 5000; now += 20) {
+    driver.heard(now);
+    TEST_ASSERT_TRUE(driver.poll(now) == PeerLiveness::Action::None);
+  }
+  TEST_ASSERT_EQUAL_UINT32(kPingIntervalMs, driver.msUntilDue(4980));
+}
+
+void test_tls_budget() {
+  ConnectionHeapModel heap;
+  const uint32_t reserve = 48 * 1024;
+  TEST_ASSERT_TRUE(heap.admitAnother(10000, reserve));  // unmeasured: slots decide
+  TEST_ASSERT_EQUAL_UINT32(0, heap.capacity(0, 200000, reserve));
+
+  // Boot: 200 kB free. Two phones connect at ~41.5 kB each.
+  heap.sample(0, 200000);
+  heap.sample(1, 158000);
+  TEST_ASSERT_EQUAL_UINT32(42000, heap.perConnectionBytes());
+  heap.sample(2, 117000);
+  TEST_ASSERT_EQUAL_UINT32(41500, heap.perConnectionBytes());
+  TEST_ASSERT_EQUAL_UINT32(3, heap.capacity(2, 117000, reserve));  // 2 open + 1 more
+  TEST_ASSERT_TRUE(heap.admitAnother(117000, reserve));
+  TEST_ASSERT_FALSE(heap.admitAnother(80000, reserve));
+
+  // The baseline follows later idle periods; heap growth is not a connection.
+  heap.sample(0, 190000);
+  heap.sample(1, 195000);
+  TEST_ASSERT_EQUAL_UINT32(41500, heap.perConnectionBytes());
+}
+
+// Wi-Fi takes another 30 kB after the first idle sample. The first
+// connection then looks like 72 kB, but once the count is back at zero the
+// new baseline corrects the estimate instead of keeping the inflated one.
+void test_tls_budget_baseline_shift() {
+  ConnectionHeapModel heap;
+  const uint32_t reserve = 48 * 1024;
+  heap.sample(0, 180000);
+  heap.sample(1, 108000);  // 30 kB of it was Wi-Fi, not TLS
+  TEST_ASSERT_EQUAL_UINT32(72000, heap.perConnectionBytes());
+  TEST_ASSERT_EQUAL_UINT32(1, heap.capacity(1, 108000, reserve));
+  TEST_ASSERT_FALSE(heap.admitAnother(108000, reserve));
+
+  heap.sample(0, 150000);
+  heap.sample(1, 108000);
+  TEST_ASSERT_EQUAL_UINT32(42000, heap.perConnectionBytes());
+  TEST_ASSERT_EQUAL_UINT32(2, heap.capacity(1, 108000, reserve));
+  TEST_ASSERT_TRUE(heap.admitAnother(108000, reserve));
+}
+
+void test_maneuver_parse() {
+  Maneuver m;
+  TEST_ASSERT_TRUE(parseManeuver("g1 w3000 g0 w1500 h", m));
+  TEST_ASSERT_EQUAL_UINT(5, m.count);
+  TEST_ASSERT_EQUAL_UINT32(4500, m.durationMs);
+
+  TEST_ASSERT_TRUE(parseManeuver("l1;g1 w600 [ s25,400 s-25.5,800 s0,400 ]4\ng0 w1000 h l0", m));
+  TEST_ASSERT_EQUAL_UINT(12, m.count);
+  TEST_ASSERT_EQUAL_UINT32(600 + 4 * 1600 + 1000, m.durationMs);
+  TEST_ASSERT_EQUAL(static_cast<int>(ManeuverOp::Sweep), static_cast<int>(m.steps[5].op));
+  TEST_ASSERT_EQUAL_FLOAT(-25.5f, m.steps[5].value);
+  TEST_ASSERT_EQUAL_UINT32(800, m.steps[5].ms);
+  TEST_ASSERT_EQUAL_FLOAT(4.0f, m.steps[7].value);
+
+  const char *const rejected[] = {"",   "  ",    "g2",    "g",      "w0",    "w-5",      "wx",
+                                  "t",  "tnan",  "s10",   "s10,",   "s10,0", "x1",       "g1w10",
+                                  "h1", "[ w10", "w10 ]2", "[ [ w10 ]2 ]2", "[ w10 ]0", "w600001", "[ w60000 ]11"};
+  for (const char *script : rejected) TEST_ASSERT_FALSE(parseManeuver(script, m));
+
+  std::string longest;
+  for (size_t i = 0; i < kManeuverMaxSteps; ++i) longest += "w1 ";
+  TEST_ASSERT_TRUE(parseManeuver(longest.c_str(), m));
+  longest += "w1";
+  TEST_ASSERT_FALSE(parseManeuver(longest.c_str(), m));
+}
+
+int main(int, char **) {
+  UNITY_BEGIN();
+  RUN_TEST(test_map_tilt_to_angle);
+  RUN_TEST(test_servo_duty);
+  RUN_TEST(test_vehicle_profiles);
+  RUN_TEST(test_motor_pwm);
+  RUN_TEST(test_motor_tick);
+  RUN_TEST(test_parse_commands);
+  RUN_TEST(test_format_state);
+  RUN_TEST(test_format_ramp);
+  RUN_TEST(test_state_frame_cache);
+  RUN_TEST(test_actuator);
+  RUN_TEST(test_actuator_across_micros_wrap);
+  RUN_TEST(test_loop_stats);
+  RUN_TEST(test_metrics);
+  RUN_TEST(test_channel_select);
+  RUN_TEST(test_admission);
+  RUN_TEST(test_async_log);
+  RUN_TEST(test_boot_phases);
+  RUN_TEST(test_liveness);
+  RUN_TEST(test_tls_budget);
+  RUN_TEST(test_tls_budget_baseline_shift);
+  RUN_TEST(test_maneuver_parse);
+  return UNITY_END();
+}